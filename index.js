@@ -2,6 +2,7 @@
  * @format
  */
 
+import './src/utils/startupMetrics'; // First, so cold-start marks measure from bundle start
 import { AppRegistry } from 'react-native';
 import App from './App';
 import { name as appName } from './app.json';
@@ -0,0 +1,149 @@
+#!/usr/bin/env node
+// Splits src/i18n/locales/<lng>.json (the files translators edit) into one small JSON
+// bundle per screen group under src/i18n/bundles/<lng>/, plus the generated loader
+// map src/i18n/bundles/index.ts. Each bundle is an i18next namespace: startup loads
+// `core`, and a screen loads its group's namespace when it mounts.
+//
+//   node scripts/build-locales.mjs            # regenerate
+//   node scripts/build-locales.mjs --check    # fail if bundles are stale or keys differ
+//   node --expose-gc scripts/build-locales.mjs --measure
+
+import { readFileSync, writeFileSync, mkdirSync, rmSync, existsSync } from 'fs';
+import { dirname, join } from 'path';
+import { fileURLToPath } from 'url';
+
+const ROOT = join(dirname(fileURLToPath(import.meta.url)), '..');
+const LOCALES = join(ROOT, 'src/i18n/locales');
+const BUNDLES = join(ROOT, 'src/i18n/bundles');
+const LANGUAGES = ['vi', 'en'];
+
+// Top-level key -> bundle. `core` is loaded at startup: shared strings and what
+// non-screen code (Api.tsx alerts, toasts, tab bar) translates
+const GROUPS = {
+  core: ['common', 'errors', 'toast', 'tabs', 'language'],
+  auth: ['auth', 'onboarding', 'otp', 'phoneVerification', 'emailVerification', 'verifyOtpBottomSheet'],
+  home: ['home', 'wallet', 'notifications'],
+  payment: ['payment', 'successTransaction', 'failedTransaction'],
+  history: ['history', 'detailHistory'],
+  account: ['profile', 'editProfile', 'changePassword', 'security', 'help'],
+  ekyc: ['verification'],
+  bank: ['bank', 'bankAccounts', 'editBankAccount', 'trc20Addresses', 'editTrc20Address'],
+};
+
+const args = process.argv.slice(2);
+
+const leafKeys = (node, prefix = '') =>
+  Object.entries(node).flatMap(([key, value]) =>
+    value && typeof value === 'object' ? leafKeys(value, `${prefix}${key}.`) : [`${prefix}${key}`],
+  );
+
+const sources = Object.fromEntries(
+  LANGUAGES.map((lng) => [lng, readFileSync(join(LOCALES, `${lng}.json`), 'utf8')]),
+);
+const parsed = Object.fromEntries(LANGUAGES.map((lng) => [lng, JSON.parse(sources[lng])]));
+
+// Every language must have the same keys: a key missing from one would quietly show
+// the fallback language's text
+const problems = [];
+const reference = new Set(leafKeys(parsed[LANGUAGES[0]]));
+for (const lng of LANGUAGES.slice(1)) {
+  const keys = new Set(leafKeys(parsed[lng]));
+  for (const key of reference) if (!keys.has(key)) problems.push(`${lng}.json is missing ${key}`);
+  for (const key of keys) if (!reference.has(key)) problems.push(`${lng}.json has extra key ${key}`);
+}
+const grouped = new Set(Object.values(GROUPS).flat());
+for (const section of Object.keys(parsed[LANGUAGES[0]])) {
+  if (!grouped.has(section)) problems.push(`section "${section}" is not assigned to a bundle in ${fileURLToPath(import.meta.url)}`);
+}
+if (problems.length) {
+  console.error(problems.join('\n'));
+  process.exit(1);
+}
+
+// Output files, path -> contents
+const outputs = new Map();
+for (const lng of LANGUAGES) {
+  for (const [bundle, sections] of Object.entries(GROUPS)) {
+    const content = Object.fromEntries(sections.map((s) => [s, parsed[lng][s]]).filter(([, v]) => v !== undefined));
+    outputs.set(join(BUNDLES, lng, `${bundle}.json`), `${JSON.stringify(content)}\n`);
+  }
+}
+
+const bundleNames = Object.keys(GROUPS);
+const index = [
+  `// Generated by scripts/build-locales.mjs from src/i18n/locales/*.json; do not edit.`,
+  `// Each loader is a require() inside a function, so Metro evaluates a bundle only`,
+  `// when it is first called.`,
+  ``,
+  `export type LocaleBundle = ${bundleNames.map((b) => `'${b}'`).join(' | ')};`,
+  ``,
+  `export const LOCALE_LANGUAGES = [${LANGUAGES.map((l) => `'${l}'`).join(', ')}] as const;`,
+  ``,
+  `export type LocaleLanguage = (typeof LOCALE_LANGUAGES)[number];`,
+  ``,
+  `export const LOCALE_BUNDLES: Record<LocaleLanguage, Record<LocaleBundle, () => object>> = {`,
+  ...LANGUAGES.flatMap((lng) => [
+    `  ${lng}: {`,
+    ...bundleNames.map((b) => `    ${b}: () => require('./${lng}/${b}.json'),`),
+    `  },`,
+  ]),
+  `};`,
+  ``,
+].join('\n');
+outputs.set(join(BUNDLES, 'index.ts'), index);
+
+if (args.includes('--check')) {
+  const stale = [...outputs].filter(([path, text]) => !existsSync(path) || readFileSync(path, 'utf8') !== text);
+  if (stale.length) {
+    console.error(`Locale bundles are out of date (run node scripts/build-locales.mjs):\n${stale.map(([p]) => `  ${p}`).join('\n')}`);
+    process.exit(1);
+  }
+  console.log(`Locale bundles up to date (${outputs.size} files)`);
+} else if (!args.includes('--measure')) {
+  for (const lng of LANGUAGES) rmSync(join(BUNDLES, lng), { recursive: true, force: true });
+  for (const [path, text] of outputs) {
+    mkdirSync(dirname(path), { recursive: true });
+    writeFileSync(path, text);
+  }
+  console.log(`Wrote ${outputs.size} files to ${BUNDLES}`);
+}
+
+if (args.includes('--measure')) {
+  // Startup cost of the locale data: before, both full files were evaluated at import;
+  // now the active language's core bundle and the fallback's (vi) core are
+  const gc = globalThis.gc;
+  const measure = (texts) => {
+    const RUNS = 200;
+    let kept = null;
+    for (let i = 0; i < 20; i++) kept = texts.map((t) => JSON.parse(t));
+    const start = performance.now();
+    for (let i = 0; i < RUNS; i++) kept = texts.map((t) => JSON.parse(t));
+    const ms = (performance.now() - start) / RUNS;
+    kept = null;
+    gc?.();
+    const before = process.memoryUsage().heapUsed;
+    kept = texts.map((t) => JSON.parse(t));
+    gc?.();
+    const retained = process.memoryUsage().heapUsed - before;
+    return { ms, kb: texts.reduce((n, t) => n + Buffer.byteLength(t), 0) / 1024, heap: retained / 1024, kept };
+  };
+  const rows = [
+    ['before: vi.json + en.json', measure(LANGUAGES.map((lng) => sources[lng]))],
+    ...LANGUAGES.map((lng) => [
+      `after: ${[...new Set([lng, LANGUAGES[0]])].map((l) => `${l}/core`).join(' + ')}`,
+      measure([...new Set([lng, LANGUAGES[0]])].map((l) => outputs.get(join(BUNDLES, l, 'core.json')))),
+    ]),
+    ...LANGUAGES.map((lng) => [
+      `every ${lng} group opened`,
+      measure(bundleNames.map((b) => outputs.get(join(BUNDLES, lng, `${b}.json`)))),
+    ]),
+  ];
+  for (const [label, r] of rows) {
+    console.log(
+      `  ${label.padEnd(26)} ${r.kb.toFixed(1).padStart(5)}KB source, ` +
+        `${r.ms.toFixed(3)} ms parse, ${gc ? `${r.heap.toFixed(0)}KB heap` : 'heap n/a'}`,
+    );
+  }
+  if (!gc) console.log('  (heap figures need node --expose-gc)');
+}
+
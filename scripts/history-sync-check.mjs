@@ -0,0 +1,108 @@
+#!/usr/bin/env node
+// Runs the app's history sync engine (src/utils/historySync.ts) against the ledger in
+// scripts/pusher-standin.mjs: checks the local copy matches the server after deltas,
+// a socket outage and a compacted cursor, and reports payload bytes per focus
+// against the old full-list fetch.
+//
+//   node scripts/pusher-standin.mjs &
+//   node --experimental-strip-types --import ./scripts/ts-resolve.mjs scripts/history-sync-check.mjs [--rows 5000 --url http://localhost:6001]
+
+import { createHistorySync } from '../src/utils/historySync.ts';
+
+const args = Object.fromEntries(
+  process.argv.slice(2).reduce((pairs, arg, i, all) => {
+    if (arg.startsWith('--')) pairs.push([arg.slice(2), all[i + 1]]);
+    return pairs;
+  }, []),
+);
+
+const BASE = args.url ?? 'http://localhost:6001';
+const TOKEN = args.token ?? 'load-test-token';
+const ROWS = Number(args.rows ?? 5000);
+
+const call = async (path, init = {}) => {
+  const res = await fetch(`${BASE}${path}`, {
+    ...init,
+    headers: { Authorization: `Bearer ${TOKEN}`, Accept: 'application/json', 'Content-Type': 'application/json', ...(init.headers ?? {}) },
+  });
+  if (!res.ok) throw new Error(`${path} -> ${res.status}`);
+  const text = await res.text();
+  return { body: JSON.parse(text), bytes: Buffer.byteLength(text) };
+};
+
+const control = (body) => call('/__control/ledger', { method: 'POST', body: JSON.stringify(body) });
+const fullList = () => call('/api/client/transactions/history');
+
+// Local side: the same replace/merge contract the transaction store implements
+const local = new Map();
+const sync = createHistorySync({
+  request: async (params) => {
+    const query = new URLSearchParams(Object.entries(params).map(([k, v]) => [k, String(v)]));
+    const { body, bytes } = await call(`/api/client/transactions/history?${query}`);
+    return { page: body, bytes };
+  },
+  replace: (list) => {
+    local.clear();
+    list.forEach((tx) => local.set(tx.id, tx));
+  },
+  merge: (list) => list.forEach((tx) => local.set(tx.id, tx)),
+});
+
+const results = [];
+let failures = 0;
+
+// Every row held locally must match the server; with `all`, nothing may be missing
+const verify = async (label, { all = false } = {}) => {
+  const { body } = await fullList();
+  const server = new Map(body.data.map((tx) => [tx.id, tx]));
+  let stale = 0;
+  for (const [id, tx] of local) {
+    const current = server.get(id);
+    if (!current || current.status !== tx.status || current.transaction_hash !== tx.transaction_hash) stale++;
+  }
+  const missing = all ? body.data.filter((tx) => !local.has(tx.id)).length : 0;
+  const newest = body.data.slice(0, 50).filter((tx) => !local.has(tx.id)).length;
+  const ok = stale === 0 && missing === 0 && newest === 0;
+  if (!ok) failures++;
+  return { ok, stale, missing: missing + newest };
+};
+
+const step = async (label, action, options) => {
+  const before = sync.stats();
+  await action();
+  const after = sync.stats();
+  const check = await verify(label, options);
+  results.push({
+    step: label,
+    bytes: after.bytes - before.bytes,
+    rows: after.rows - before.rows,
+    requests: after.pages - before.pages,
+    local: local.size,
+    consistent: check.ok ? 'yes' : `NO (stale ${check.stale}, missing ${check.missing})`,
+  });
+};
+
+await control({ seed: ROWS });
+const legacy = await fullList();
+results.push({ step: 'legacy full fetch (every focus before)', bytes: legacy.bytes, rows: legacy.body.data.length, requests: 1, local: '-', consistent: '-' });
+
+await step('first focus', () => sync.sync());
+await step('focus, nothing changed', () => sync.sync());
+await control({ updates: 20, inserts: 5 });
+await step('focus after 20 updates + 5 new', () => sync.sync());
+// Socket down while 300 transfer events land: the delta must carry all of them
+await control({ updates: 300 });
+await step('gap: 300 missed events', () => sync.sync());
+await control({ updates: 10, compact: true });
+await step('cursor compacted -> reset', () => sync.sync());
+await step('scroll: one older page', () => sync.loadOlder());
+await step('scroll to the end', async () => {
+  while (!sync.checkpoint().complete) await sync.loadOlder();
+}, { all: true });
+await control({ updates: 5 });
+await step('focus after full scroll', () => sync.sync(), { all: true });
+
+console.table(results);
+const focus = results.find((r) => r.step === 'focus after 20 updates + 5 new');
+console.log(`bytes per focus: ${focus.bytes} vs ${legacy.bytes} full (${(legacy.bytes / Math.max(focus.bytes, 1)).toFixed(0)}x less)`);
+process.exit(failures ? 1 : 0);
@@ -0,0 +1,487 @@
+#!/usr/bin/env node
+// Local stand-in for the Pusher-protocol broadcast server and the two Laravel
+// endpoints the app needs, so socket/echo.ts and SocketContext can be exercised
+// without mimo.dragonlab.vn. Zero dependencies (node >= 18).
+//
+//   node scripts/pusher-standin.mjs [--port 6001] [--key local-key] [--secret local-secret]
+//
+// App side (dev only), before SocketProvider mounts:
+//   configureEcho({ apiBase: 'http://10.0.2.2:6001', host: '10.0.2.2', port: 6001, forceTLS: false, key: 'local-key' })
+//
+// HTTP:
+//   POST /api/broadcasting/auth        private-channel auth (any Bearer token except "invalid")
+//   GET  /api/me/broadcast-channel     { channel: "private-notifications.token.<hash>" }
+//   GET  /api/client/transactions/history
+//        no params: full list (legacy); limit: newest page; updated_after=<cursor>: changes
+//        since the cursor; before_id=<id>: older page. Paged replies carry
+//        meta { cursor, has_more } or meta { reset: true } once the cursor is compacted away.
+//   GET  /api/client/exchange/rate     { rate, fee, quote_id, expires_at }, quotes live --quote-ttl s
+//   POST /api/client/create-transactions/{vnd-usdt,usdt-vnd}
+//        409 { code: "quote_expired" } for an unknown or expired quote_id; no quote_id is accepted
+//   POST /__control/stream             start a synthetic event stream (JSON body, see DEFAULT_STREAM)
+//   POST /__control/disconnect         drop every socket now
+//   GET  /__control/stats              counters for the current stream
+//   POST /__control/ledger             { seed, updates, inserts, compact } on the history ledger
+
+import http from 'node:http';
+import crypto from 'node:crypto';
+
+const args = Object.fromEntries(
+  process.argv.slice(2).reduce((pairs, arg, i, all) => {
+    if (arg.startsWith('--')) pairs.push([arg.slice(2), all[i + 1]]);
+    return pairs;
+  }, []),
+);
+
+const PORT = Number(args.port ?? 6001);
+const APP_KEY = args.key ?? 'local-key';
+const APP_SECRET = args.secret ?? 'local-secret';
+const WS_GUID = '258EAFA5-E914-47DA-95CA-C5AB0DC85B11';
+const EVENT_NAME = 'NotificationSuccessTransferEvent';
+const QUOTE_TTL = Number(args['quote-ttl'] ?? 30) * 1000;
+
+const DEFAULT_STREAM = {
+  rate: 100, // events per second
+  durationMs: 10000,
+  latencyMs: 0, // added before each send
+  jitterMs: 0, // +/- random spread on latency
+  duplicateRatio: 0, // share of events re-sent with the same transaction id
+  disconnectEveryMs: 0, // drop all sockets on this period (0 = never)
+  transactions: 500, // distinct transaction ids cycled through
+};
+
+const sockets = new Set();
+let stream = null;
+const stats = { emitted: 0, sent: 0, duplicates: 0, disconnects: 0, connections: 0 };
+
+const channelForToken = (token) =>
+  `private-notifications.token.${crypto.createHash('sha256').update(token).digest('hex').slice(0, 12)}`;
+
+const sign = (socketId, channel) =>
+  `${APP_KEY}:${crypto.createHmac('sha256', APP_SECRET).update(`${socketId}:${channel}`).digest('hex')}`;
+
+// ---- WebSocket framing (RFC 6455, text frames only) ----
+
+const encodeFrame = (text, opcode = 0x1) => {
+  const payload = Buffer.from(text);
+  const length = payload.length;
+  let header;
+  if (length < 126) {
+    header = Buffer.from([0x80 | opcode, length]);
+  } else if (length < 65536) {
+    header = Buffer.alloc(4);
+    header[0] = 0x80 | opcode;
+    header[1] = 126;
+    header.writeUInt16BE(length, 2);
+  } else {
+    header = Buffer.alloc(10);
+    header[0] = 0x80 | opcode;
+    header[1] = 127;
+    header.writeBigUInt64BE(BigInt(length), 2);
+  }
+  return Buffer.concat([header, payload]);
+};
+
+// Returns [frames, rest]
+const decodeFrames = (buffer) => {
+  const frames = [];
+  let offset = 0;
+  while (buffer.length - offset >= 2) {
+    const opcode = buffer[offset] & 0x0f;
+    const masked = (buffer[offset + 1] & 0x80) !== 0;
+    let length = buffer[offset + 1] & 0x7f;
+    let cursor = offset + 2;
+    if (length === 126) {
+      if (buffer.length < cursor + 2) break;
+      length = buffer.readUInt16BE(cursor);
+      cursor += 2;
+    } else if (length === 127) {
+      if (buffer.length < cursor + 8) break;
+      length = Number(buffer.readBigUInt64BE(cursor));
+      cursor += 8;
+    }
+    const maskLength = masked ? 4 : 0;
+    if (buffer.length < cursor + maskLength + length) break;
+    const mask = masked ? buffer.subarray(cursor, cursor + 4) : null;
+    cursor += maskLength;
+    const payload = Buffer.from(buffer.subarray(cursor, cursor + length));
+    if (mask) for (let i = 0; i < payload.length; i++) payload[i] ^= mask[i & 3];
+    frames.push({ opcode, payload });
+    offset = cursor + length;
+  }
+  return [frames, buffer.subarray(offset)];
+};
+
+// ---- Pusher protocol ----
+
+const send = (client, message) => {
+  if (!client.socket.destroyed) client.socket.write(encodeFrame(JSON.stringify(message)));
+};
+
+const handleMessage = (client, message) => {
+  switch (message.event) {
+    case 'pusher:ping':
+      send(client, { event: 'pusher:pong', data: '{}' });
+      break;
+    case 'pusher:subscribe': {
+      const { channel, auth } = message.data ?? {};
+      if (channel.startsWith('private-') && auth !== sign(client.socketId, channel)) {
+        send(client, {
+          event: 'pusher:error',
+          data: JSON.stringify({ code: 4009, message: `Invalid signature for ${channel}` }),
+        });
+        return;
+      }
+      client.channels.add(channel);
+      send(client, { event: 'pusher_internal:subscription_succeeded', channel, data: '{}' });
+      break;
+    }
+    case 'pusher:unsubscribe':
+      client.channels.delete(message.data?.channel);
+      break;
+  }
+};
+
+const acceptUpgrade = (req, socket) => {
+  const key = req.headers['sec-websocket-key'];
+  if (!key || !req.url.startsWith(`/app/${APP_KEY}`)) {
+    socket.end('HTTP/1.1 400 Bad Request\r\n\r\n');
+    return;
+  }
+  const accept = crypto.createHash('sha1').update(key + WS_GUID).digest('base64');
+  socket.write(
+    'HTTP/1.1 101 Switching Protocols\r\n' +
+      'Upgrade: websocket\r\nConnection: Upgrade\r\n' +
+      `Sec-WebSocket-Accept: ${accept}\r\n\r\n`,
+  );
+  socket.setNoDelay(true);
+
+  const client = {
+    socket,
+    socketId: `${crypto.randomInt(1e6)}.${crypto.randomInt(1e9)}`,
+    channels: new Set(),
+  };
+  sockets.add(client);
+  stats.connections++;
+  send(client, {
+    event: 'pusher:connection_established',
+    data: JSON.stringify({ socket_id: client.socketId, activity_timeout: 120 }),
+  });
+
+  let pending = Buffer.alloc(0);
+  socket.on('data', (chunk) => {
+    const [frames, rest] = decodeFrames(Buffer.concat([pending, chunk]));
+    pending = rest;
+    for (const { opcode, payload } of frames) {
+      if (opcode === 0x8) {
+        socket.end(encodeFrame('', 0x8));
+      } else if (opcode === 0x9) {
+        socket.write(encodeFrame(payload.toString(), 0xa));
+      } else if (opcode === 0x1) {
+        try {
+          handleMessage(client, JSON.parse(payload.toString()));
+        } catch (error) {
+          console.log('[standin] bad message', error.message);
+        }
+      }
+    }
+  });
+  socket.on('close', () => sockets.delete(client));
+  socket.on('error', () => sockets.delete(client));
+};
+
+const broadcast = (channel, data) => {
+  const message = { event: EVENT_NAME, channel, data: JSON.stringify(data) };
+  for (const client of sockets) {
+    if (client.channels.has(channel)) {
+      send(client, message);
+      stats.sent++;
+    }
+  }
+};
+
+const dropAll = () => {
+  stats.disconnects++;
+  for (const client of sockets) client.socket.destroy();
+  sockets.clear();
+};
+
+// ---- Transaction history ledger ----
+
+// Every write bumps `version`; a row remembers the version that last touched it,
+// which is what the change cursor walks.
+const ledger = { rows: new Map(), version: 0, compactedAt: 0, nextId: 1 };
+
+const ledgerRow = (id, status) => {
+  const buy = id % 2 === 1;
+  return {
+    id,
+    type: buy ? 1 : 2,
+    address: 'TQn9Y2khEsLJW1ChVWFMSMeRDow5KcbLSE',
+    network: 'TRC20',
+    detail_bank_id: buy ? null : '1',
+    bank_account: buy ? null : '0123456789',
+    rate: 26500,
+    amount_usdt: 100 + (id % 900),
+    amount_vnd: 2650000 + id * 1000,
+    amount_vnd_real: 2640000 + id * 1000,
+    fee_percent: 0.003,
+    fee_vnd: 7950,
+    transaction_hash: status === 1 ? crypto.randomBytes(32).toString('hex') : null,
+    note: `MIMO${String(id).padStart(6, '0')}`,
+    status,
+    bank_name: buy ? null : 'Vietcombank',
+    bank_address: null,
+    created_at: new Date(Date.UTC(2024, 0, 1) + id * 3600 * 1000).toISOString(),
+    version: ++ledger.version,
+  };
+};
+
+const seedLedger = (count) => {
+  ledger.rows.clear();
+  ledger.version = 0;
+  ledger.compactedAt = 0;
+  for (let id = 1; id <= count; id++) ledger.rows.set(id, ledgerRow(id, id % 3));
+  ledger.nextId = count + 1;
+};
+
+const touchLedger = (id, patch) => {
+  const row = ledger.rows.get(id);
+  if (row) Object.assign(row, patch, { version: ++ledger.version });
+};
+
+const mutateLedger = ({ updates = 0, inserts = 0 }) => {
+  const existing = Array.from(ledger.rows.keys());
+  for (let i = 0; i < updates && existing.length; i++) {
+    const id = existing[crypto.randomInt(existing.length)];
+    const status = ledger.rows.get(id).status === 1 ? 2 : 1;
+    touchLedger(id, { status, transaction_hash: status === 1 ? crypto.randomBytes(32).toString('hex') : null });
+  }
+  for (let i = 0; i < inserts; i++) {
+    const id = ledger.nextId++;
+    ledger.rows.set(id, ledgerRow(id, 0));
+  }
+};
+
+const publicRow = ({ version, ...row }) => row;
+const newestFirst = (a, b) => b.id - a.id;
+
+const historyReply = (params) => {
+  const rows = Array.from(ledger.rows.values());
+  const limit = Number(params.get('limit') ?? 0);
+  if (!limit) return { status: true, data: rows.sort(newestFirst).map(publicRow) };
+
+  if (params.has('updated_after')) {
+    const after = Number(params.get('updated_after'));
+    if (after < ledger.compactedAt) return { status: true, data: [], meta: { reset: true } };
+    const changed = rows.filter((row) => row.version > after).sort((a, b) => a.version - b.version);
+    const page = changed.slice(0, limit);
+    const hasMore = changed.length > limit;
+    return {
+      status: true,
+      data: page.map(publicRow),
+      meta: { cursor: String(hasMore ? page[page.length - 1].version : ledger.version), has_more: hasMore },
+    };
+  }
+
+  const before = params.has('before_id') ? Number(params.get('before_id')) : Infinity;
+  const older = rows.filter((row) => row.id < before).sort(newestFirst);
+  return {
+    status: true,
+    data: older.slice(0, limit).map(publicRow),
+    meta: {
+      cursor: params.has('before_id') ? undefined : String(ledger.version),
+      has_more: older.length > limit,
+    },
+  };
+};
+
+// ---- Synthetic stream ----
+
+const makeEvent = (seq, transactions, duplicateOf) => {
+  const id = duplicateOf ?? (seq % transactions) + 1;
+  const buy = id % 2 === 1;
+  return {
+    seq,
+    emitted_at: Date.now(),
+    id_transaction: id,
+    type: buy ? 1 : 2,
+    status: 1,
+    note: `MIMO${String(id).padStart(6, '0')}`,
+    amount_usdt: 100 + (id % 900),
+    amount_vnd: 2650000 + id * 1000,
+    amount_vnd_real: 2640000 + id * 1000,
+    rate: 26500,
+    fee_percent: 0.003,
+    fee_vnd: 7950,
+    transaction_hash: crypto.randomBytes(32).toString('hex'),
+    bank_name: buy ? null : 'Vietcombank',
+    bank_account: buy ? null : '0123456789',
+    sent_at: new Date().toISOString(),
+  };
+};
+
+const startStream = (channel, options) => {
+  if (stream) stopStream();
+  const config = { ...DEFAULT_STREAM, ...options };
+  Object.assign(stats, { emitted: 0, sent: 0, duplicates: 0, disconnects: 0 });
+  const interval = 1000 / config.rate;
+  const startedAt = Date.now();
+  let seq = 0;
+  let lastId = 1;
+
+  const emitDue = () => {
+    // Catch up on every event due since start, so timer drift does not lower the rate
+    const due = Math.min(Math.floor((Date.now() - startedAt) / interval), Math.floor(config.rate * config.durationMs / 1000));
+    while (seq < due) {
+      seq++;
+      const duplicate = seq > 1 && Math.random() < config.duplicateRatio;
+      if (duplicate) stats.duplicates++;
+      const event = makeEvent(seq, config.transactions, duplicate ? lastId : undefined);
+      lastId = event.id_transaction;
+      // Sockets that miss this event can recover it through the history cursor
+      touchLedger(event.id_transaction, { status: event.status, transaction_hash: event.transaction_hash });
+      stats.emitted++;
+      const delay = config.latencyMs + (Math.random() * 2 - 1) * config.jitterMs;
+      if (delay > 0) {
+        setTimeout(() => broadcast(channel, event), delay);
+      } else {
+        broadcast(channel, event);
+      }
+    }
+    if (Date.now() - startedAt >= config.durationMs && seq >= due) stopStream();
+  };
+
+  stream = {
+    config,
+    channel,
+    timer: setInterval(emitDue, Math.max(1, Math.min(interval, 10))),
+    dropper: config.disconnectEveryMs > 0 ? setInterval(dropAll, config.disconnectEveryMs) : null,
+  };
+  console.log(`[standin] streaming ${config.rate}/s for ${config.durationMs}ms to ${channel}`);
+};
+
+const stopStream = () => {
+  if (!stream) return;
+  clearInterval(stream.timer);
+  if (stream.dropper) clearInterval(stream.dropper);
+  stream = null;
+};
+
+// ---- Rate quotes ----
+
+// A quote is reissued only once the current one is within 5s of expiring, so
+// clients asking early all get the same id
+const quotes = { current: null, issued: new Map(), rateCalls: 0, accepted: 0, rejected: 0 };
+
+const currentQuote = () => {
+  const now = Date.now();
+  if (!quotes.current || quotes.current.expiresAt - now < 5000) {
+    const rate = 26400 + Math.round(Math.random() * 200);
+    quotes.current = { id: crypto.randomBytes(8).toString('hex'), rate, expiresAt: now + QUOTE_TTL };
+    quotes.issued.set(quotes.current.id, quotes.current);
+  }
+  const { id, rate, expiresAt } = quotes.current;
+  return { rate, fee: 0.5, quote_id: id, expires_at: new Date(expiresAt).toISOString() };
+};
+
+// ---- HTTP ----
+
+const readBody = (req) =>
+  new Promise((resolve) => {
+    let body = '';
+    req.on('data', (chunk) => (body += chunk));
+    req.on('end', () => {
+      if (!body) return resolve({});
+      try {
+        resolve(JSON.parse(body));
+      } catch {
+        resolve(Object.fromEntries(new URLSearchParams(body)));
+      }
+    });
+  });
+
+const json = (res, status, body) => {
+  res.writeHead(status, { 'Content-Type': 'application/json' });
+  res.end(JSON.stringify(body));
+};
+
+const bearer = (req) => (req.headers.authorization || '').replace(/^Bearer\s+/i, '');
+
+const server = http.createServer(async (req, res) => {
+  const url = new URL(req.url, `http://${req.headers.host}`);
+  const token = bearer(req);
+
+  if (url.pathname === '/api/me/broadcast-channel' && req.method === 'GET') {
+    if (!token) return json(res, 401, { message: 'Unauthenticated.' });
+    return json(res, 200, { channel: channelForToken(token) });
+  }
+
+  if (url.pathname === '/api/broadcasting/auth' && req.method === 'POST') {
+    const { socket_id: socketId, channel_name: channel } = await readBody(req);
+    if (!token || token === 'invalid') return json(res, 403, { message: 'Forbidden' });
+    if (channel !== channelForToken(token)) return json(res, 403, { message: 'Forbidden' });
+    return json(res, 200, { auth: sign(socketId, channel) });
+  }
+
+  if (url.pathname === '/api/client/transactions/history' && req.method === 'GET') {
+    if (!token) return json(res, 401, { message: 'Unauthenticated.' });
+    return json(res, 200, historyReply(url.searchParams));
+  }
+
+  if (url.pathname === '/api/client/exchange/rate' && req.method === 'GET') {
+    quotes.rateCalls++;
+    return json(res, 200, currentQuote());
+  }
+
+  if (url.pathname.startsWith('/api/client/create-transactions/') && req.method === 'POST') {
+    if (!token) return json(res, 401, { message: 'Unauthenticated.' });
+    const { quote_id: quoteId } = await readBody(req);
+    const quote = quoteId ? quotes.issued.get(quoteId) : null;
+    if (quoteId && (!quote || quote.expiresAt <= Date.now())) {
+      quotes.rejected++;
+      return json(res, 409, { status: false, code: 'quote_expired', message: 'Quote expired' });
+    }
+    quotes.accepted++;
+    return json(res, 200, { status: true, data: { id_transaction: ledger.nextId++ } });
+  }
+
+  if (url.pathname === '/__control/ledger' && req.method === 'POST') {
+    const body = await readBody(req);
+    if (body.seed != null) seedLedger(Number(body.seed));
+    mutateLedger({ updates: Number(body.updates ?? 0), inserts: Number(body.inserts ?? 0) });
+    // Forget the change log: any older cursor now gets { reset: true }
+    if (body.compact) ledger.compactedAt = ledger.version;
+    return json(res, 200, { ok: true, rows: ledger.rows.size, version: ledger.version });
+  }
+
+  if (url.pathname === '/__control/stream' && req.method === 'POST') {
+    const body = await readBody(req);
+    const channel = body.channel ?? (token ? channelForToken(token) : null);
+    if (!channel) return json(res, 400, { message: 'channel or Bearer token required' });
+    startStream(channel, body);
+    return json(res, 200, { ok: true, config: stream.config });
+  }
+
+  if (url.pathname === '/__control/disconnect' && req.method === 'POST') {
+    dropAll();
+    return json(res, 200, { ok: true });
+  }
+
+  if (url.pathname === '/__control/stats') {
+    const { rateCalls, accepted, rejected } = quotes;
+    return json(res, 200, {
+      ...stats,
+      streaming: !!stream,
+      sockets: sockets.size,
+      quotes: { rateCalls, issued: quotes.issued.size, accepted, rejected },
+    });
+  }
+
+  json(res, 404, { message: 'Not found' });
+});
+
+server.on('upgrade', acceptUpgrade);
+server.listen(PORT, () => {
+  console.log(`[standin] Pusher stand-in on http://localhost:${PORT} (key=${APP_KEY})`);
+});
@@ -0,0 +1,168 @@
+#!/usr/bin/env node
+// Client-side load harness against scripts/pusher-standin.mjs. Speaks the same
+// protocol as pusher-js (connect, private-channel auth, subscribe) and feeds events
+// through the app's own pipeline and formatter (src/utils/eventPipeline.ts,
+// src/socket/transferMessage.ts), then reports processing latency, dropped events,
+// reconnects and heap growth.
+//
+//   node scripts/pusher-standin.mjs &
+//   node --experimental-strip-types --import ./scripts/ts-resolve.mjs scripts/socket-load.mjs --rate 500 --duration 60000 \
+//        [--latency 50 --jitter 20 --dup 0.2 --disconnect-every 15000 --url http://localhost:6001]
+
+import { createEventPipeline } from '../src/utils/eventPipeline.ts';
+import { buildTransferNotification, transferKey } from '../src/socket/transferMessage.ts';
+
+const args = Object.fromEntries(
+  process.argv.slice(2).reduce((pairs, arg, i, all) => {
+    if (arg.startsWith('--')) pairs.push([arg.slice(2), all[i + 1]]);
+    return pairs;
+  }, []),
+);
+
+const BASE = args.url ?? 'http://localhost:6001';
+const KEY = args.key ?? 'local-key';
+const TOKEN = args.token ?? 'load-test-token';
+const RATE = Number(args.rate ?? 200);
+const DURATION = Number(args.duration ?? 30000);
+const FRAME_MS = 16;
+// Settle time after the stream ends before counting drops
+const DRAIN_MS = Number(args.drain ?? 3000) + Number(args.latency ?? 0) + Number(args.jitter ?? 0);
+
+const t = (key) => key;
+
+const percentile = (values, p) => {
+  if (!values.length) return 0;
+  const sorted = Float64Array.from(values).sort();
+  return sorted[Math.min(sorted.length - 1, Math.ceil((p / 100) * sorted.length) - 1)];
+};
+
+const api = async (path, init = {}) => {
+  const res = await fetch(`${BASE}${path}`, {
+    ...init,
+    headers: { Authorization: `Bearer ${TOKEN}`, Accept: 'application/json', ...(init.headers ?? {}) },
+  });
+  if (!res.ok) throw new Error(`${path} -> ${res.status}`);
+  return res.json();
+};
+
+// ---- Measurements ----
+
+const seen = new Set();
+const endToEndMs = [];
+const flushMs = [];
+const heap = [];
+let received = 0;
+let reconnects = 0;
+let maxSeq = 0;
+
+const pipeline = createEventPipeline({
+  keyOf: transferKey,
+  schedule: (cb) => setTimeout(cb, FRAME_MS),
+  flush: (batch) => {
+    const start = performance.now();
+    batch.map((data) => buildTransferNotification(data, t));
+    const now = Date.now();
+    flushMs.push(performance.now() - start);
+    for (const data of batch) endToEndMs.push(now - data.emitted_at);
+  },
+});
+
+// ---- Pusher client ----
+
+const { channel } = await api('/api/me/broadcast-channel');
+let closedOnPurpose = false;
+let attempt = 0;
+
+const connect = () => {
+  const wsUrl = `${BASE.replace(/^http/, 'ws')}/app/${KEY}?protocol=7&client=load&version=1`;
+  const ws = new WebSocket(wsUrl);
+
+  ws.onmessage = async (message) => {
+    const { event, data, channel: from } = JSON.parse(message.data);
+    if (event === 'pusher:connection_established') {
+      attempt = 0;
+      const { socket_id: socketId } = JSON.parse(data);
+      const { auth } = await api('/api/broadcasting/auth', {
+        method: 'POST',
+        headers: { 'Content-Type': 'application/x-www-form-urlencoded' },
+        body: new URLSearchParams({ socket_id: socketId, channel_name: channel }).toString(),
+      });
+      ws.send(JSON.stringify({ event: 'pusher:subscribe', data: { channel, auth } }));
+    } else if (event === 'NotificationSuccessTransferEvent' && from === channel) {
+      const payload = JSON.parse(data);
+      received++;
+      seen.add(payload.seq);
+      if (payload.seq > maxSeq) maxSeq = payload.seq;
+      pipeline.enqueue(payload);
+    } else if (event === 'pusher:error') {
+      console.log('[load] server error', data);
+    }
+  };
+
+  ws.onclose = () => {
+    if (closedOnPurpose) return;
+    reconnects++;
+    // Same policy as SocketManager: full jitter, 1s base, 30s cap
+    const delay = Math.floor(Math.random() * Math.min(30000, 1000 * 2 ** attempt++));
+    setTimeout(connect, delay);
+  };
+  ws.onerror = () => {};
+  return ws;
+};
+
+let socket = connect();
+await new Promise((resolve) => setTimeout(resolve, 500));
+
+const heapTimer = setInterval(() => heap.push(process.memoryUsage().heapUsed), 1000);
+heap.push(process.memoryUsage().heapUsed);
+
+await api('/__control/stream', {
+  method: 'POST',
+  headers: { 'Content-Type': 'application/json' },
+  body: JSON.stringify({
+    rate: RATE,
+    durationMs: DURATION,
+    latencyMs: Number(args.latency ?? 0),
+    jitterMs: Number(args.jitter ?? 0),
+    duplicateRatio: Number(args.dup ?? 0),
+    disconnectEveryMs: Number(args['disconnect-every'] ?? 0),
+  }),
+});
+
+await new Promise((resolve) => setTimeout(resolve, DURATION + DRAIN_MS));
+pipeline.drain();
+clearInterval(heapTimer);
+closedOnPurpose = true;
+socket.close();
+
+const server = await api('/__control/stats');
+const stats = pipeline.stats();
+const mb = (bytes) => (bytes / 1024 / 1024).toFixed(1);
+
+console.log(
+  JSON.stringify(
+    {
+      emitted: server.emitted,
+      received,
+      dropped: server.emitted - seen.size,
+      deduped: stats.deduped,
+      flushes: stats.flushes,
+      maxBatch: stats.maxBatch,
+      reconnects,
+      latencyMs: {
+        p50: percentile(endToEndMs, 50),
+        p99: percentile(endToEndMs, 99),
+        max: percentile(endToEndMs, 100),
+      },
+      flushMs: {
+        p50: +percentile(flushMs, 50).toFixed(2),
+        p99: +percentile(flushMs, 99).toFixed(2),
+        max: +percentile(flushMs, 100).toFixed(2),
+      },
+      heapMB: { start: mb(heap[0]), end: mb(heap[heap.length - 1]), peak: mb(Math.max(...heap)) },
+    },
+    null,
+    2,
+  ),
+);
+process.exit(0);
@@ -0,0 +1,20 @@
+// Lets the node scripts import app modules from src/ as-is: extensionless relative
+// imports ('../utils/format') resolve to the .ts file, the way Metro resolves them.
+//
+//   node --experimental-strip-types --import ./scripts/ts-resolve.mjs scripts/<script>.mjs
+
+import { register } from 'node:module';
+
+register(
+  'data:text/javascript,' +
+    encodeURIComponent(`
+      export async function resolve(specifier, context, next) {
+        try {
+          return await next(specifier, context);
+        } catch (error) {
+          if (!specifier.startsWith('.') || /\\.[cm]?[jt]sx?$/.test(specifier)) throw error;
+          return next(specifier + '.ts', context);
+        }
+      }
+    `),
+);
@@ -1,21 +1,26 @@
-import React from 'react';
+import React, { useEffect, useMemo, useState } from 'react';
 import {
   View,
   Text,
+  Image,
   StyleSheet,
   TouchableOpacity,
   Share,
   Platform,
   PermissionsAndroid,
+  PixelRatio,
 } from 'react-native';
-import QRCodeSVG from 'react-native-qrcode-svg';
+import { type QRCodeErrorCorrectionLevel } from 'qrcode';
 import Icon from 'react-native-vector-icons/MaterialCommunityIcons';
 import { theme } from '../theme/colors';
+import { QrImageCache, type QrImageSpec } from '../utils/qrImageCache';
+import { type QrRaster } from '../utils/qrImage';
 
 interface QRCodeProps {
   value: string;
   size?: number;
   quietZone?: number;
+  ecl?: QRCodeErrorCorrectionLevel;
   label?: string;
   error?: string;
   showShare?: boolean;
@@ -27,13 +32,40 @@ const QRCode: React.FC<QRCodeProps> = ({
   value,
   size = 200,
   quietZone = 0,
+  ecl = 'M',
   label,
   error,
   showShare = true,
   showDownload = true,
   onDownload,
 }) => {
-  let qrRef: any = null;
+  // Encoded once per (value, pixel size, level) and shown as a single bitmap drawn
+  // at a whole number of device pixels per module, so it stays sharp
+  const spec = useMemo<QrImageSpec>(
+    () => ({
+      value,
+      pixels: PixelRatio.getPixelSizeForLayoutSize(size),
+      ecl,
+      dark: theme.colors.text,
+      light: theme.colors.white,
+    }),
+    [value, size, ecl],
+  );
+  const [raster, setRaster] = useState<QrRaster | undefined>(() => QrImageCache.peek(spec));
+
+  useEffect(() => {
+    let active = true;
+    const hit = QrImageCache.peek(spec);
+    setRaster(hit);
+    if (!hit && value) {
+      QrImageCache.get(spec)
+        .then((next) => active && setRaster(next))
+        .catch((error) => console.error('Error encoding QR code:', error));
+    }
+    return () => {
+      active = false;
+    };
+  }, [spec, value]);
 
   const handleShare = async () => {
     try {
@@ -75,14 +107,15 @@ const QRCode: React.FC<QRCodeProps> = ({
     <View style={styles.container}>
       {label && <Text style={styles.label}>{label}</Text>}
       <View style={styles.qrContainer}>
-        <QRCodeSVG
-          value={value}
-          size={size}
-          color={theme.colors.text}
-          backgroundColor={theme.colors.white}
-          quietZone={quietZone}
-          getRef={c => (qrRef = c)}
-        />
+        <View style={[styles.qrBox, { width: size + quietZone * 2, height: size + quietZone * 2 }]}>
+          {raster && (
+            <Image
+              source={{ uri: raster.uri }}
+              style={{ width: raster.pixels / PixelRatio.get(), height: raster.pixels / PixelRatio.get() }}
+              fadeDuration={0}
+            />
+          )}
+        </View>
       </View>
       {/* <View style={styles.actions}>
         {showShare && (
@@ -121,6 +154,11 @@ const styles = StyleSheet.create({
     borderRadius: theme.borderRadius.md,
     ...theme.shadows.md,
   },
+  qrBox: {
+    alignItems: 'center',
+    justifyContent: 'center',
+    backgroundColor: theme.colors.white,
+  },
   actions: {
     flexDirection: 'row',
     marginTop: theme.spacing.md,
@@ -0,0 +1,52 @@
+import React, { memo, useRef, useSyncExternalStore } from 'react';
+import { StyleProp, View, ViewStyle } from 'react-native';
+import Svg, { G, Path } from 'react-native-svg';
+import { type ChartBody, type TickRing, layoutChart } from '../utils/rateHistory';
+
+interface RateChartProps {
+  ring: TickRing;
+  width: number;
+  height: number;
+  color?: string;
+  strokeWidth?: number;
+  style?: StyleProp<ViewStyle>;
+}
+
+// Memoized on `d`, which only changes when the downsampled body is rebuilt: a new
+// tick re-renders the tail and the transform but does not re-send this path
+const Line = memo(({ d, color, strokeWidth }: { d: string; color: string; strokeWidth: number }) => (
+  <Path d={d} stroke={color} strokeWidth={strokeWidth} fill="none" vectorEffect="non-scaling-stroke" />
+));
+
+// One <Path> of ~`width` LTTB points plus a short raw tail, instead of an SVG node
+// per tick. Paths are in data units and placed by a single matrix, so time passing
+// or the range widening moves the line without rebuilding it.
+const RateChart: React.FC<RateChartProps> = ({
+  ring,
+  width,
+  height,
+  color = '#26A17B',
+  strokeWidth = 2,
+  style,
+}) => {
+  // Re-render per tick; the layout decides how little of it changes
+  useSyncExternalStore(ring.subscribe, ring.end);
+  const bodyRef = useRef<ChartBody | null>(null);
+  const frame = layoutChart(ring, width, height, bodyRef.current);
+  bodyRef.current = frame?.body ?? null;
+
+  return (
+    <View style={[{ width, height }, style]}>
+      {frame && (
+        <Svg width={width} height={height}>
+          <G transform={frame.transform}>
+            <Line d={frame.body.d} color={color} strokeWidth={strokeWidth} />
+            <Path d={frame.tail.d} stroke={color} strokeWidth={strokeWidth} fill="none" vectorEffect="non-scaling-stroke" />
+          </G>
+        </Svg>
+      )}
+    </View>
+  );
+};
+
+export default RateChart;
@@ -0,0 +1,28 @@
+import React, { useEffect, useState } from 'react';
+import { Text, TextStyle, StyleProp } from 'react-native';
+import { useExchangeRateStore } from '../services/ExchangeRateService';
+
+interface RateCountdownProps {
+  format?: (seconds: number) => string;
+  style?: StyleProp<TextStyle>;
+}
+
+// Owns the 1s ticker so only this Text re-renders each second, not the whole screen
+const RateCountdown: React.FC<RateCountdownProps> = ({
+  format = (seconds) => `${seconds}s`,
+  style,
+}) => {
+  const nextRefreshAt = useExchangeRateStore((s) => s.nextRefreshAt);
+  const [now, setNow] = useState(Date.now());
+
+  useEffect(() => {
+    setNow(Date.now());
+    const timer = setInterval(() => setNow(Date.now()), 1000);
+    return () => clearInterval(timer);
+  }, [nextRefreshAt]);
+
+  const seconds = Math.max(0, Math.ceil((nextRefreshAt - now) / 1000));
+  return <Text style={style}>{format(seconds)}</Text>;
+};
+
+export default RateCountdown;
@@ -58,7 +58,7 @@ const VerifyOTPBottomSheet: React.FC<VerifyOTPBottomSheetProps> = ({
   resendDisabledSeconds = 60,
   endpoints,
 }) => {
-  const { t } = useTranslation();
+  const { t } = useTranslation('auth');
   const [modalVisible, setModalVisible] = useState<boolean>(false);
   const [slideAnim] = useState(new Animated.Value(SCREEN_HEIGHT));
   const [otp, setOtp] = useState<string[]>(Array.from({ length: OTP_LENGTH }, () => ''));
@@ -1,6 +1,7 @@
 import React, { createContext, useContext, useState, useEffect } from 'react';
 import { authApi, User, SignUpData } from '../utils/authApi';
 import { EkycVerifyRequest, EkycVerifyResponse } from '../types/ekyc';
+import { TransactionSyncService } from '../services/TransactionSyncService';
 
 // Types
 type UserRole = 'individual' | 'business' | 'farmer' | 'bank' | 'cooperative' | 'verifier' | 'government' | 'buyer';
@@ -59,6 +60,7 @@ export const AuthProvider: React.FC<{ children: React.ReactNode }> = ({ children
   const signOut = async () => {
     try {
       await authApi.signOut();
+      await TransactionSyncService.reset();
       setUser(null);
     } catch (error: any) {
       console.log('Sign out error:', error);
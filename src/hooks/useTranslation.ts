@@ -1,8 +1,18 @@
 import { useTranslation as useI18nTranslation } from 'react-i18next';
 import i18n from '../i18n';
+import { type LocaleBundle } from '../i18n/bundles';
 
-export const useTranslation = () => {
-  const { t, i18n: i18nInstance } = useI18nTranslation();
+// `groups` are the locale bundles (i18next namespaces) the screen translates from
+// besides `core`. They load synchronously here, before react-i18next checks them,
+// so the first render is already translated. Before the language is detected,
+// react-i18next loads them itself once i18next is initialized.
+export const useTranslation = (groups: LocaleBundle | LocaleBundle[] = []) => {
+  const namespaces = [...(Array.isArray(groups) ? groups : [groups]), 'core'];
+  if (i18n.isInitialized) {
+    const missing = namespaces.filter((ns) => !i18n.hasLoadedNamespace(ns));
+    if (missing.length) i18n.loadNamespaces(missing);
+  }
+  const { t, i18n: i18nInstance } = useI18nTranslation(namespaces);
 
   const changeLanguage = async (languageCode: string) => {
     try {
@@ -0,0 +1,32 @@
+// Generated by scripts/build-locales.mjs from src/i18n/locales/*.json; do not edit.
+// Each loader is a require() inside a function, so Metro evaluates a bundle only
+// when it is first called.
+
+export type LocaleBundle = 'core' | 'auth' | 'home' | 'payment' | 'history' | 'account' | 'ekyc' | 'bank';
+
+export const LOCALE_LANGUAGES = ['vi', 'en'] as const;
+
+export type LocaleLanguage = (typeof LOCALE_LANGUAGES)[number];
+
+export const LOCALE_BUNDLES: Record<LocaleLanguage, Record<LocaleBundle, () => object>> = {
+  vi: {
+    core: () => require('./vi/core.json'),
+    auth: () => require('./vi/auth.json'),
+    home: () => require('./vi/home.json'),
+    payment: () => require('./vi/payment.json'),
+    history: () => require('./vi/history.json'),
+    account: () => require('./vi/account.json'),
+    ekyc: () => require('./vi/ekyc.json'),
+    bank: () => require('./vi/bank.json'),
+  },
+  en: {
+    core: () => require('./en/core.json'),
+    auth: () => require('./en/auth.json'),
+    home: () => require('./en/home.json'),
+    payment: () => require('./en/payment.json'),
+    history: () => require('./en/history.json'),
+    account: () => require('./en/account.json'),
+    ekyc: () => require('./en/ekyc.json'),
+    bank: () => require('./en/bank.json'),
+  },
+};
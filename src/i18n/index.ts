@@ -1,19 +1,42 @@
 import i18n from 'i18next';
 import { initReactI18next } from 'react-i18next';
 import * as RNLocalize from 'react-native-localize';
-import AsyncStorage from '@react-native-async-storage/async-storage';
+import { KVStore } from '../utils/kvStore';
+import { LOCALE_BUNDLES, LOCALE_LANGUAGES, type LocaleBundle, type LocaleLanguage } from './bundles';
 
-// Import translation files
-import vi from './locales/vi.json';
-import en from './locales/en.json';
+// Translations are split per screen group (scripts/build-locales.mjs), one i18next
+// namespace per group. Startup loads `core`; a screen loads its group through
+// hooks/useTranslation. Keys stay 'section.key'. The fallback language's core ships
+// with init, so a key missing from the active language always has a fallback.
+const FALLBACK_LANGUAGE: LocaleLanguage = 'vi';
+
+// Reads a namespace from the generated bundles. The require() is synchronous, so a
+// namespace is usable as soon as loadNamespaces returns
+const BUNDLE_BACKEND = {
+  type: 'backend' as const,
+  init: () => {},
+  read: (lng: string, ns: string, callback: (error: any, data: any) => void) => {
+    const load = LOCALE_BUNDLES[lng as LocaleLanguage]?.[ns as LocaleBundle];
+    if (!load) {
+      callback(null, {});
+      return;
+    }
+    try {
+      callback(null, load());
+    } catch (error) {
+      callback(error, null);
+    }
+  },
+};
 
 const LANGUAGE_DETECTOR = {
   type: 'languageDetector' as const,
   async: true,
   detect: async (callback: (lng: string) => void) => {
     try {
-      // Try to get saved language from AsyncStorage
-      const savedLanguage = await AsyncStorage.getItem('user-language');
+      // Try to get saved language (hot key, loaded together with token/user)
+      await KVStore.ready();
+      const savedLanguage = KVStore.getString('user-language');
       if (savedLanguage) {
         callback(savedLanguage);
         return;
@@ -30,7 +53,8 @@ const LANGUAGE_DETECTOR = {
   init: () => {},
   cacheUserLanguage: async (language: string) => {
     try {
-      await AsyncStorage.setItem('user-language', language);
+      KVStore.setString('user-language', language);
+      await KVStore.flushed();
     } catch (error) {
       console.log('Error saving language to storage:', error);
     }
@@ -39,14 +63,26 @@ const LANGUAGE_DETECTOR = {
 
 i18n
   .use(LANGUAGE_DETECTOR)
+  .use(BUNDLE_BACKEND)
   .use(initReactI18next)
   .init({
     compatibilityJSON: 'v4',
+    // Bundled up front; every other namespace comes through the backend
     resources: {
-      vi: { translation: vi },
-      en: { translation: en },
+      [FALLBACK_LANGUAGE]: { core: LOCALE_BUNDLES[FALLBACK_LANGUAGE].core() },
+    },
+    partialBundledLanguages: true,
+    ns: ['core'],
+    defaultNS: 'core',
+    fallbackNS: 'core',
+    supportedLngs: [...LOCALE_LANGUAGES],
+    load: 'languageOnly',
+    fallbackLng: FALLBACK_LANGUAGE,
+    // There is no Suspense boundary: a screen rendered before language detection
+    // finishes re-renders once its namespace is in
+    react: {
+      useSuspense: false,
     },
-    fallbackLng: 'vi',
     debug: __DEV__,
     interpolation: {
       escapeValue: false,
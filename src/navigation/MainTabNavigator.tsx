@@ -44,6 +44,7 @@ import ChangePasswordScreen from '../screens/ChangePasswordScreen';
 import SuccessTransactionDetailScreen from '../screens/SuccessTransactionDetailScreen';
 import FailedTransactionDetailScreen from '../screens/FailedTransactionDetailScreen';
 import TestSocketScreen from '../screens/TestSocketScreen';
+import ApiMetricsScreen from '../screens/ApiMetricsScreen';
 
 const Stack = createNativeStackNavigator<RootStackParamList>();
 const Tab = createBottomTabNavigator<RootStackParamList>();
@@ -169,6 +170,7 @@ const MainNavigator = () => {
 
         {/* Test */}
         <Stack.Screen name="TestSocket" component={TestSocketScreen} />
+        {__DEV__ && <Stack.Screen name="ApiMetrics" component={ApiMetricsScreen} />}
       </Stack.Group>
 
     </Stack.Navigator>
@@ -110,6 +110,9 @@ export type RootStackParamList = {
   Security: undefined;
   Notifications: undefined;
   Help: undefined;
+
+  // Debug
+  ApiMetrics: undefined;
 };
 
 export type StackScreen<T extends keyof RootStackParamList> = React.FC<NativeStackScreenProps<RootStackParamList, T>>;
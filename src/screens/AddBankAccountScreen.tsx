@@ -35,7 +35,7 @@ interface BankData {
 
 const AddBankAccountScreen = () => {
   const navigation = useNavigation();
-  const { t } = useTranslation();
+  const { t } = useTranslation('bank');
   const [banks, setBanks] = useState<BankData[]>([]);
   const [selectedBankId, setSelectedBankId] = useState<string>('');
   const [accountNumber, setAccountNumber] = useState('');
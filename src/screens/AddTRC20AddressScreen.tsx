@@ -20,10 +20,11 @@ import {
 import api from '../utils/Api';
 import { useTranslation } from '../hooks/useTranslation';
 import VerifyOTPBottomSheet from '../component/VerifyOTPBottomSheet';
+import { checkTronAddress } from '../utils/tronAddress';
 
 const AddTRC20AddressScreen = () => {
   const navigation = useNavigation();
-  const { t } = useTranslation();
+  const { t } = useTranslation('bank');
   const [name, setName] = useState('');
   const [address, setAddress] = useState('');
   const [isDefault, setIsDefault] = useState(false);
@@ -32,6 +33,12 @@ const AddTRC20AddressScreen = () => {
   const [showOtp, setShowOtp] = useState(false);
   const [identifier, setIdentifier] = useState<string>('');
   const [identifierType, setIdentifierType] = useState<'email' | 'phone'>('email');
+  // Checked on every keystroke (Base58Check, no allocation), so a typo shows before submit
+  const addressCheck = checkTronAddress(address);
+  const addressError = errors.address
+    || (addressCheck === 'invalid' || addressCheck === 'invalid-char'
+      ? t('trc20Addresses.validation.addressInvalid')
+      : '');
 
   // Prefill identifier from profile
   useEffect(() => {
@@ -64,7 +71,9 @@ const AddTRC20AddressScreen = () => {
     
     if (!address.trim()) {
       newErrors.address = t('trc20Addresses.validation.addressRequired');
-    } 
+    } else if (addressCheck !== 'valid') {
+      newErrors.address = t('trc20Addresses.validation.addressInvalid');
+    }
     setErrors(newErrors);
     return Object.keys(newErrors).length === 0;
   };
@@ -179,7 +188,7 @@ const AddTRC20AddressScreen = () => {
 
         {/* TRC20 Address */}
         <Text style={styles.label}>{t('trc20Addresses.walletAddress')}</Text>
-        <View style={[styles.addressInputContainer, errors.address && styles.inputError]}>
+        <View style={[styles.addressInputContainer, !!addressError && styles.inputError]}>
           <TextInput
             style={styles.addressInput}
             value={address}
@@ -208,7 +217,7 @@ const AddTRC20AddressScreen = () => {
             </TouchableOpacity>
           </View>
         </View>
-        {errors.address && <Text style={styles.errorText}>{errors.address}</Text>}
+        {!!addressError && <Text style={styles.errorText}>{addressError}</Text>}
 
         {/* Default Address Toggle */}
         <View style={styles.defaultContainer}>
@@ -0,0 +1,165 @@
+import React, { useCallback, useEffect, useState } from 'react';
+import {
+  View,
+  Text,
+  StyleSheet,
+  FlatList,
+  TouchableOpacity,
+} from 'react-native';
+import { SafeAreaView } from 'react-native-safe-area-context';
+import Icon from 'react-native-vector-icons/MaterialCommunityIcons';
+import { useNavigation } from '@react-navigation/native';
+import { ApiMetrics, PHASES, RouteSnapshot } from '../utils/apiMetrics';
+import { SocketManager } from '../socket/connectionManager';
+
+// Hidden debug screen (long-press the avatar on Profile): per-route latency and payload numbers
+const formatMs = (ms: number) => (ms >= 100 ? ms.toFixed(0) : ms.toFixed(1));
+
+const formatBytes = (bytes: number) => {
+  if (bytes >= 1024 * 1024) return `${(bytes / 1024 / 1024).toFixed(1)} MB`;
+  if (bytes >= 1024) return `${(bytes / 1024).toFixed(1)} KB`;
+  return `${bytes} B`;
+};
+
+const ApiMetricsScreen = () => {
+  const navigation = useNavigation();
+  const [routes, setRoutes] = useState<RouteSnapshot[]>([]);
+  const [socket, setSocket] = useState(SocketManager.getMetrics());
+
+  const refresh = useCallback(() => {
+    setRoutes(ApiMetrics.snapshot());
+    setSocket(SocketManager.getMetrics());
+  }, []);
+
+  useEffect(() => {
+    refresh();
+    const timer = setInterval(refresh, 2000);
+    return () => clearInterval(timer);
+  }, [refresh]);
+
+  const renderRoute = ({ item }: { item: RouteSnapshot }) => (
+    <View style={styles.card}>
+      <Text style={styles.route}>{item.route}</Text>
+      <Text style={styles.summary}>
+        {item.count} req • {item.errors} err • {item.retries} retry • in {formatBytes(item.bytesIn)} • out {formatBytes(item.bytesOut)}
+      </Text>
+      <View style={styles.row}>
+        <Text style={[styles.cell, styles.cellLabel]}>ms</Text>
+        <Text style={styles.cell}>p50</Text>
+        <Text style={styles.cell}>p99</Text>
+        <Text style={styles.cell}>max</Text>
+      </View>
+      {PHASES.map((phase) => (
+        <View key={phase} style={styles.row}>
+          <Text style={[styles.cell, styles.cellLabel]}>{phase}</Text>
+          <Text style={styles.cell}>{formatMs(item.phases[phase].p50)}</Text>
+          <Text style={styles.cell}>{formatMs(item.phases[phase].p99)}</Text>
+          <Text style={styles.cell}>{formatMs(item.phases[phase].max)}</Text>
+        </View>
+      ))}
+    </View>
+  );
+
+  return (
+    <SafeAreaView style={styles.container}>
+      <View style={styles.header}>
+        <TouchableOpacity style={styles.backButton} onPress={() => navigation.goBack()}>
+          <Icon name="arrow-left" size={24} color="#1C1C1E" />
+        </TouchableOpacity>
+        <Text style={styles.headerTitle}>API Metrics</Text>
+        <TouchableOpacity
+          style={styles.backButton}
+          onPress={() => {
+            ApiMetrics.reset();
+            refresh();
+          }}
+        >
+          <Icon name="delete-outline" size={24} color="#1C1C1E" />
+        </TouchableOpacity>
+      </View>
+      <FlatList
+        data={routes}
+        keyExtractor={(item) => item.route}
+        renderItem={renderRoute}
+        contentContainerStyle={styles.content}
+        ListHeaderComponent={
+          <View style={styles.card}>
+            <Text style={styles.route}>WebSocket • {socket.state}</Text>
+            <Text style={styles.summary}>
+              {socket.reconnects} reconnects • {formatMs(socket.disconnectedMs / 1000)}s disconnected
+            </Text>
+          </View>
+        }
+        ListEmptyComponent={<Text style={styles.empty}>No requests recorded yet</Text>}
+      />
+    </SafeAreaView>
+  );
+};
+
+const styles = StyleSheet.create({
+  container: {
+    flex: 1,
+    backgroundColor: '#FFFFFF',
+  },
+  header: {
+    flexDirection: 'row',
+    alignItems: 'center',
+    justifyContent: 'space-between',
+    padding: 16,
+    borderBottomWidth: 1,
+    borderBottomColor: '#F2F2F7',
+  },
+  backButton: {
+    width: 40,
+    height: 40,
+    justifyContent: 'center',
+    alignItems: 'center',
+  },
+  headerTitle: {
+    fontSize: 18,
+    fontWeight: '600',
+    color: '#1C1C1E',
+  },
+  content: {
+    padding: 16,
+  },
+  card: {
+    backgroundColor: '#F8F9FA',
+    borderRadius: 12,
+    padding: 12,
+    marginBottom: 12,
+  },
+  route: {
+    fontSize: 14,
+    fontWeight: '600',
+    color: '#1C1C1E',
+  },
+  summary: {
+    fontSize: 12,
+    color: '#666666',
+    marginTop: 4,
+    marginBottom: 8,
+  },
+  row: {
+    flexDirection: 'row',
+    paddingVertical: 2,
+  },
+  cell: {
+    flex: 1,
+    fontSize: 12,
+    color: '#1C1C1E',
+    textAlign: 'right',
+    fontVariant: ['tabular-nums'],
+  },
+  cellLabel: {
+    textAlign: 'left',
+    color: '#666666',
+  },
+  empty: {
+    textAlign: 'center',
+    color: '#999999',
+    marginTop: 32,
+  },
+});
+
+export default ApiMetricsScreen;
@@ -43,7 +43,7 @@ type BankAccount = {
 
 const BankAccountsScreen = () => {
   const navigation = useNavigation();
-  const { t } = useTranslation();
+  const { t } = useTranslation('bank');
   const [accounts, setAccounts] = useState<BankAccount[]>([]);
   const [banks, setBanks] = useState<{[key: number]: { name: string; code: string; }}>({});
   const [loading, setLoading] = useState(true);
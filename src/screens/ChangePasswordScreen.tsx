@@ -39,7 +39,7 @@ interface ChangePasswordScreenProps {
 }
 
 const ChangePasswordScreen: React.FC<ChangePasswordScreenProps> = ({ navigation, route }) => {
-  const { t } = useTranslation();
+  const { t } = useTranslation(['account', 'auth']);
   const { identifier, type, token } = route.params;
   const [newPassword, setNewPassword] = useState('');
   const [confirmPassword, setConfirmPassword] = useState('');
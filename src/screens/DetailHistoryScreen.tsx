@@ -18,8 +18,11 @@ import {
   heightPercentageToDP as hp,
 } from 'react-native-responsive-screen';
 import QRCode from '../component/QRCode';
-import api from '../utils/Api';
 import { getUser } from '../utils/TokenManager';
+import { QueryCache } from '../utils/queryCache';
+import { formatDate, formatTime, formatVND } from '../utils/format';
+import { bankAccountsQuery, pendingTransactionQuery } from '../utils/queries';
+import { useTransactionStore } from '../socket/transactionStore';
 import { useTranslation } from '../hooks/useTranslation';
 
 type TransactionDetail = {
@@ -54,7 +57,7 @@ const DetailHistoryScreen = () => {
   const transactionParam = params.transaction as TransactionDetail | undefined;
   const idTransaction = params.idTransaction as number | undefined;
   const typeParam = params.type as 'buy' | 'sell' | undefined;
-  const { t } = useTranslation();
+  const { t } = useTranslation('history');
 
   const [transaction, setTransaction] = React.useState<TransactionDetail | undefined>(transactionParam);
   const [loading, setLoading] = useState<boolean>(!!idTransaction && !transactionParam);
@@ -68,13 +71,14 @@ const DetailHistoryScreen = () => {
 
   const fetchBankAccounts = async () => {
     try {
-      const response = await api.get('/client/bank/data');
-      if (response.data.status) {
-        const accounts = response.data.data.map((acc: any) => ({
+      // Usually already warm from the HistoryScreen row's press-in
+      const data = await QueryCache.fetch(bankAccountsQuery);
+      if (data?.status) {
+        const accounts = data.data.map((acc: any) => ({
           bank_name: acc.bank_code,
           bank_number: acc.bank_number
         }));
-        console.log('accounts', response.data.data);
+        console.log('accounts', data.data);
         setBankAccounts(accounts);
       }
     } catch (error) {
@@ -90,11 +94,24 @@ const DetailHistoryScreen = () => {
     }
   }, []);
 
+  // Live status pushed over the socket (see SocketContext)
+  const liveStatus = useTransactionStore((s) =>
+    idTransaction != null ? s.byId[idTransaction]?.status : undefined
+  );
+
+  React.useEffect(() => {
+    if (liveStatus !== 1 && liveStatus !== 2) return;
+    setTransaction((prev) => (prev && prev.status !== liveStatus ? { ...prev, status: liveStatus } : prev));
+  }, [liveStatus]);
+
   // 15-minute validity timer
   const [secondsLeft, setSecondsLeft] = React.useState(900);
   const isExpired = secondsLeft <= 0;
 
   React.useEffect(() => {
+    // No more ticking once the transfer has settled or the window has closed
+    if (transaction && transaction.status !== 0) return;
+    if (isExpired) return;
     // Calculate remaining time based on created_at if available
     const interval = setInterval(() => {
       if (transaction?.createdAt) {
@@ -108,40 +125,39 @@ const DetailHistoryScreen = () => {
       }
     }, 1000);
     return () => clearInterval(interval);
-  }, [transaction?.createdAt]);
+  }, [transaction?.createdAt, transaction?.status, isExpired]);
 
   React.useEffect(() => {
     const fetchPending = async () => {
-      if (!idTransaction || transaction || !user?.email) return;
+      if (!idTransaction || transaction) return;
       setLoading(true);
       try {
-        // Determine API endpoint based on transaction type
-        const endpoint = typeParam === 'sell' 
-          ? '/client/transaction-pending/usdt-vnd' 
-          : '/client/transaction-pending/vnd-usdt';
-        
-        const res = await api.post(endpoint, {
-          email: user.email,
-          id_transaction: idTransaction,
-        });
-        if (res?.data?.status) {
-          console.log('res', res.data);
-          const d = res.data.data || {};
+        // Endpoint is picked from the transaction type; joins a prefetch if one is in flight
+        const resData = await QueryCache.fetch(pendingTransactionQuery(typeParam, idTransaction));
+        if (resData?.status) {
+          console.log('res', resData);
+          const d = resData.data || {};
+
+          // Opened straight from Payment: register it so transfer events can find it by order code
+          const txStore = useTransactionStore.getState();
+          if (!txStore.byId[idTransaction]) {
+            txStore.upsert({ id: idTransaction, note: d.order_code || undefined, status: 0 });
+          }
           
           if (typeParam === 'sell') {
             // Sell USDT mapping
             const mapped: TransactionDetail = {
               id: String(idTransaction),
               type: 'sell',
-              amount: parseFloat(String(d.amount_vnd ?? '')).toLocaleString('vi-VN'), // USDT amount to sell
+              amount: formatVND(d.amount_vnd), // USDT amount to sell
               usdt: String(d.amount_usd ?? ''), // USDT amount to sell
-              exchangeRate: parseFloat(String(d.rate ?? '')).toLocaleString('vi-VN'),
+              exchangeRate: formatVND(d.rate),
               status: 0,
-              date: d.created_at ? new Date(d.created_at).toLocaleDateString('vi-VN') : new Date().toLocaleDateString('vi-VN'),
-              time: d.created_at ? new Date(d.created_at).toLocaleTimeString('vi-VN', { hour: '2-digit', minute: '2-digit' }) : new Date().toLocaleTimeString('vi-VN', { hour: '2-digit', minute: '2-digit' }),
+              date: formatDate(d.created_at),
+              time: formatTime(d.created_at),
               transactionId: d.order_code || '',
-              fee: `${(d.fee_vnd ?? 0).toLocaleString('vi-VN')} VND`,
-              totalAmount: `${(d.total_vnd ?? 0).toLocaleString('vi-VN')} VND`, // Amount to receive
+              fee: `${formatVND(d.fee_vnd ?? 0)} VND`,
+              totalAmount: `${formatVND(d.total_vnd ?? 0)} VND`, // Amount to receive
               receiveAddress: d.address_wallet || undefined, // TRC20 wallet to send USDT to
               createdAt: d.created_at || undefined,
               transferInfo: {
@@ -149,7 +165,7 @@ const DetailHistoryScreen = () => {
                 accountNumber: d.bank_number || '',
                 accountName: d.bank_account || '',
                 transferContent: d.order_code || '',
-                amount: (d.total_vnd ?? 0).toLocaleString('vi-VN'), // Amount to receive
+                amount: formatVND(d.total_vnd ?? 0), // Amount to receive
               },
             };
             setTransaction(mapped);
@@ -158,15 +174,15 @@ const DetailHistoryScreen = () => {
             const mapped: TransactionDetail = {
               id: String(idTransaction),
               type: 'buy',
-              amount: parseFloat(String(d.amount_vnd ?? '')).toLocaleString('vi-VN'),
+              amount: formatVND(d.amount_vnd),
               usdt: String(d.amount_usd ?? ''),
-              exchangeRate: parseFloat(String(d.rate ?? '')).toLocaleString('vi-VN'),
+              exchangeRate: formatVND(d.rate),
               status: 0,
-              date: d.created_at ? new Date(d.created_at).toLocaleDateString('vi-VN') : new Date().toLocaleDateString('vi-VN'),
-              time: d.created_at ? new Date(d.created_at).toLocaleTimeString('vi-VN', { hour: '2-digit', minute: '2-digit' }) : new Date().toLocaleTimeString('vi-VN', { hour: '2-digit', minute: '2-digit' }),
+              date: formatDate(d.created_at),
+              time: formatTime(d.created_at),
               transactionId: d.order_code || '',
-              fee: `${(d.fee_vnd ?? 0).toLocaleString('vi-VN')} VND`,
-              totalAmount: `${(d.total_vnd ?? 0).toLocaleString('vi-VN')} VND`,
+              fee: `${formatVND(d.fee_vnd ?? 0)} VND`,
+              totalAmount: `${formatVND(d.total_vnd ?? 0)} VND`,
               qrPayload: d.qr_code || undefined,
               createdAt: d.created_at || undefined,
               transferInfo: {
@@ -174,7 +190,7 @@ const DetailHistoryScreen = () => {
                 accountNumber: d.bank_number || '',
                 accountName: d.bank_account || '',
                 transferContent: d.qr_code ? (d.order_code || '') : (d.order_code || ''),
-                amount: (d.total_vnd ?? 0).toLocaleString('vi-VN'),
+                amount: formatVND(d.total_vnd ?? 0),
               },
             };
             setTransaction(mapped);
@@ -187,9 +203,9 @@ const DetailHistoryScreen = () => {
       }
     };
     fetchPending();
-  }, [idTransaction, transaction, typeParam, user?.email]);
+  }, [idTransaction, transaction, typeParam]);
 
-  const formatTime = (s: number) => {
+  const formatCountdown = (s: number) => {
     const m = Math.floor(s / 60).toString().padStart(2, '0');
     const ss = Math.floor(s % 60).toString().padStart(2, '0');
     return `${m}:${ss}`;
@@ -198,13 +214,8 @@ const DetailHistoryScreen = () => {
   // Format createdAt timestamp to Vietnamese format
   const formatCreatedAt = (createdAt: string) => {
     try {
-      const date = new Date(createdAt);
-      const dateStr = date.toLocaleDateString('vi-VN');
-      const timeStr = date.toLocaleTimeString('vi-VN', { 
-        hour: '2-digit', 
-        minute: '2-digit',
-        hour12: false 
-      });
+      const dateStr = formatDate(createdAt);
+      const timeStr = formatTime(createdAt);
       return `${dateStr} • ${timeStr}`;
     } catch (error) {
       console.error('Error formatting createdAt:', error);
@@ -292,7 +303,7 @@ const DetailHistoryScreen = () => {
         <View style={[styles.validityBar, { backgroundColor: isExpired ? '#FFEBEE' : '#FFF4E6', borderColor: isExpired ? '#FF3B30' : '#FF9500' }]}>
           <Icon name={isExpired ? 'timer-off' : 'timer'} size={18} color={isExpired ? '#FF3B30' : '#FF9500'} />
           <Text style={[styles.validityText, { color: isExpired ? '#FF3B30' : '#FF9500' }]}>
-            {isExpired ? t('detailHistory.expired') : t('detailHistory.validFor15Minutes', { time: formatTime(secondsLeft) })}
+            {isExpired ? t('detailHistory.expired') : t('detailHistory.validFor15Minutes', { time: formatCountdown(secondsLeft) })}
           </Text>
         </View>
 
@@ -538,7 +549,7 @@ const DetailHistoryScreen = () => {
         <View style={[styles.validityBar, { backgroundColor: isExpired ? '#FFEBEE' : '#FFF4E6', borderColor: isExpired ? '#FF3B30' : '#FF9500' }]}>
           <Icon name={isExpired ? 'timer-off' : 'timer'} size={18} color={isExpired ? '#FF3B30' : '#FF9500'} />
           <Text style={[styles.validityText, { color: isExpired ? '#FF3B30' : '#FF9500' }]}>
-            {isExpired ? t('detailHistory.expired') : t('detailHistory.validFor15Minutes', { time: formatTime(secondsLeft) })}
+            {isExpired ? t('detailHistory.expired') : t('detailHistory.validFor15Minutes', { time: formatCountdown(secondsLeft) })}
           </Text>
         </View>
 
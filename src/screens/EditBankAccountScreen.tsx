@@ -49,7 +49,7 @@ const EditBankAccountScreen: StackScreen<'EditBankAccount'> = () => {
   const navigation = useNavigation();
   const route = useRoute();
   const { account } = route.params as { account: BankAccountData };
-  const { t } = useTranslation();
+  const { t } = useTranslation('bank');
 
   const [banks, setBanks] = useState<BankData[]>([]);
   const [selectedBankId, setSelectedBankId] = useState<string>(account.id_bank.toString());
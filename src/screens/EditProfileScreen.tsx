@@ -41,7 +41,7 @@ interface UserProfile {
 }
 
 const EditProfileScreen = () => {
-  const { t } = useTranslation();
+  const { t } = useTranslation('account');
   const navigation = useNavigation();
   const [loading, setLoading] = useState(true);
   const [saving, setSaving] = useState(false);
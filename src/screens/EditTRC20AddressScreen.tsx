@@ -21,6 +21,7 @@ import api from '../utils/Api';
 import VerifyOTPBottomSheet from '../component/VerifyOTPBottomSheet';
 import { getUser } from '../utils/TokenManager';
 import useTranslation from '../hooks/useTranslation';
+import { checkTronAddress } from '../utils/tronAddress';
 
 type TRC20Address = {
   id: string;
@@ -33,9 +34,12 @@ const EditTRC20AddressScreen = () => {
   const navigation = useNavigation();
   const route = useRoute();
   const addressData = (route.params as any)?.address as TRC20Address;
-  const { t } = useTranslation();
+  const { t } = useTranslation('bank');
 
   const [name, setName] = useState(addressData?.name || '');
+  // The address cannot be edited here; older entries that fail the TRON check are
+  // flagged (not blocked) so the user knows to replace them
+  const addressValid = !addressData?.address || checkTronAddress(addressData.address) === 'valid';
   const [isDefault, setIsDefault] = useState(addressData?.isDefault || false);
   const [isLoading, setIsLoading] = useState(false);
   const [showOtp, setShowOtp] = useState(false);
@@ -230,7 +234,7 @@ const EditTRC20AddressScreen = () => {
 
         {/* TRC20 Address (Non-editable) */}
         <Text style={styles.label}>{t('editTrc20Address.polygonAddressLabel')}</Text>
-        <View style={styles.addressContainer}>
+        <View style={[styles.addressContainer, !addressValid && styles.addressContainerInvalid]}>
           <Text style={styles.addressText}>{addressData?.address}</Text>
           <TouchableOpacity 
             style={styles.copyButton}
@@ -239,6 +243,9 @@ const EditTRC20AddressScreen = () => {
             <Icon name="content-copy" size={20} color="#4A90E2" />
           </TouchableOpacity>
         </View>
+        {!addressValid && (
+          <Text style={styles.addressWarning}>{t('editTrc20Address.addressInvalidWarning')}</Text>
+        )}
 
         {/* Default Address Toggle */}
         <View style={styles.defaultContainer}>
@@ -351,6 +358,15 @@ const styles = StyleSheet.create({
     borderWidth: 1,
     borderColor: '#E5E5EA',
   },
+  addressContainerInvalid: {
+    borderColor: '#FF6B6B',
+  },
+  addressWarning: {
+    fontSize: wp('3%'),
+    color: '#FF6B6B',
+    marginTop: 4,
+    marginLeft: 4,
+  },
   addressText: {
     flex: 1,
     fontSize: wp('4%'),
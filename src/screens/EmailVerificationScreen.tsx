@@ -26,7 +26,7 @@ const { width, height } = Dimensions.get('window');
 
 const EmailVerificationScreen = () => {
   const navigation = useNavigation();
-  const { t } = useTranslation();
+  const { t } = useTranslation('auth');
   const [email, setEmail] = useState('');
   const [code, setCode] = useState('');
   const [isCodeSent, setIsCodeSent] = useState(false);
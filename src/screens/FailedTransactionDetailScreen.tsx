@@ -18,7 +18,9 @@ import {
   heightPercentageToDP as hp,
 } from 'react-native-responsive-screen';
 import { getUser } from '../utils/TokenManager';
-import api from '../utils/Api';
+import { QueryCache } from '../utils/queryCache';
+import { formatDate, formatTime, formatVND } from '../utils/format';
+import { failedTransactionQuery } from '../utils/queries';
 import { useTranslation } from '../hooks/useTranslation';
 
 type FailedTransactionDetail = {
@@ -47,7 +49,7 @@ type FailedTransactionDetail = {
 };
 
 const FailedTransactionDetailScreen = () => {
-  const { t } = useTranslation();
+  const { t } = useTranslation(['payment', 'history']);
   const navigation = useNavigation();
   const route = useRoute();
   const params: any = route.params || {};
@@ -85,15 +87,15 @@ const FailedTransactionDetailScreen = () => {
       const mapped: FailedTransactionDetail = {
         id: String(d.id),
         type: 'sell',
-        amount: parseFloat(String(d.amount_vnd_real ?? '')).toLocaleString('vi-VN'), // VND amount that would have been received
+        amount: formatVND(d.amount_vnd_real), // VND amount that would have been received
         usdt: String(d.amount_usdt ?? ''), // USDT amount that would have been sold
-        exchangeRate: parseFloat(String(d.rate ?? '')).toLocaleString('vi-VN'),
+        exchangeRate: formatVND(d.rate),
         status: d.status || 2, // Use actual status or default to Failed
-        date: d.created_at ? new Date(d.created_at).toLocaleDateString('vi-VN') : new Date().toLocaleDateString('vi-VN'),
-        time: d.created_at ? new Date(d.created_at).toLocaleTimeString('vi-VN', { hour: '2-digit', minute: '2-digit' }) : new Date().toLocaleTimeString('vi-VN', { hour: '2-digit', minute: '2-digit' }),
+        date: formatDate(d.created_at || Date.now()),
+        time: formatTime(d.created_at || Date.now()),
         transactionId: d.transaction_hash || '',
-        fee: `${(d.fee_vnd ?? 0).toLocaleString('vi-VN')} VND`,
-        totalAmount: `${(d.amount_vnd_real ?? 0).toLocaleString('vi-VN')} VND`, // Amount that would have been received
+        fee: `${formatVND(d.fee_vnd ?? 0)} VND`,
+        totalAmount: `${formatVND(d.amount_vnd_real ?? 0)} VND`, // Amount that would have been received
         receiveAddress: d.address || undefined, // TRC20 wallet USDT would have been sent from
         createdAt: d.created_at || undefined,
         transferInfo: {
@@ -101,7 +103,7 @@ const FailedTransactionDetailScreen = () => {
           accountNumber: d.bank_account || '',
           accountName: d.bank_address || '',
           transferContent: d.transaction_hash || '',
-          amount: (d.amount_vnd_real ?? 0).toLocaleString('vi-VN'), // Amount that would have been received
+          amount: formatVND(d.amount_vnd_real ?? 0), // Amount that would have been received
         },
       };
       setTransaction(mapped);
@@ -110,15 +112,15 @@ const FailedTransactionDetailScreen = () => {
       const mapped: FailedTransactionDetail = {
         id: String(d.id),
         type: 'buy',
-        amount: parseFloat(String(d.amount_vnd ?? '')).toLocaleString('vi-VN'),
+        amount: formatVND(d.amount_vnd),
         usdt: String(d.amount_usdt ?? ''),
-        exchangeRate: parseFloat(String(d.rate ?? '')).toLocaleString('vi-VN'),
+        exchangeRate: formatVND(d.rate),
         status: d.status || 2, // Use actual status or default to Failed
-        date: d.created_at ? new Date(d.created_at).toLocaleDateString('vi-VN') : new Date().toLocaleDateString('vi-VN'),
-        time: d.created_at ? new Date(d.created_at).toLocaleTimeString('vi-VN', { hour: '2-digit', minute: '2-digit' }) : new Date().toLocaleTimeString('vi-VN', { hour: '2-digit', minute: '2-digit' }),
+        date: formatDate(d.created_at || Date.now()),
+        time: formatTime(d.created_at || Date.now()),
         transactionId: d.transaction_hash || '',
-        fee: `${(d.fee_vnd ?? 0).toLocaleString('vi-VN')} VND`,
-        totalAmount: `${(d.amount_vnd_real ?? 0).toLocaleString('vi-VN')} VND`,
+        fee: `${formatVND(d.fee_vnd ?? 0)} VND`,
+        totalAmount: `${formatVND(d.amount_vnd_real ?? 0)} VND`,
         qrPayload: d.transaction_hash || undefined,
         createdAt: d.created_at || undefined,
         transferInfo: {
@@ -126,7 +128,7 @@ const FailedTransactionDetailScreen = () => {
           accountNumber: d.bank_account || '',
           accountName: d.bank_address || '',
           transferContent: d.transaction_hash || '',
-          amount: (d.amount_vnd_real ?? 0).toLocaleString('vi-VN'),
+          amount: formatVND(d.amount_vnd_real ?? 0),
         },
       };
       setTransaction(mapped);
@@ -135,21 +137,14 @@ const FailedTransactionDetailScreen = () => {
 
   React.useEffect(() => {
     const fetchFailedTransaction = async () => {
-      if (!idTransaction || transaction || !user?.email) return;
+      if (!idTransaction || transaction) return;
       setLoading(true);
       try {
-        // Determine API endpoint based on transaction type
-        const endpoint = typeParam === 'sell' 
-          ? '/client/transaction-failed/usdt-vnd' 
-          : '/client/transaction-failed/vnd-usdt';
-        
-        const res = await api.post(endpoint, {
-          email: user.email,
-          id_transaction: idTransaction,
-        });
-        if (res?.data?.status) {
-          console.log('Failed transaction res', res.data);
-          const d = res.data.data || {};
+        // Endpoint is picked from the transaction type; joins a prefetch if one is in flight
+        const resData = await QueryCache.fetch(failedTransactionQuery(typeParam, idTransaction));
+        if (resData?.status) {
+          console.log('Failed transaction res', resData);
+          const d = resData.data || {};
           convertTransaction(d);
         }
       } catch (err : any) {
@@ -159,18 +154,13 @@ const FailedTransactionDetailScreen = () => {
       }
     };
     fetchFailedTransaction();
-  }, [idTransaction, transaction, typeParam, user?.email]);
+  }, [idTransaction, transaction, typeParam]);
 
   // Format createdAt timestamp to Vietnamese format
   const formatCreatedAt = (createdAt: string) => {
     try {
-      const date = new Date(createdAt);
-      const dateStr = date.toLocaleDateString('vi-VN');
-      const timeStr = date.toLocaleTimeString('vi-VN', { 
-        hour: '2-digit', 
-        minute: '2-digit',
-        hour12: false 
-      });
+      const dateStr = formatDate(createdAt);
+      const timeStr = formatTime(createdAt);
       return `${dateStr} • ${timeStr}`;
     } catch (error) {
       console.error('Error formatting createdAt:', error);
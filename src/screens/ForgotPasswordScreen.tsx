@@ -34,7 +34,7 @@ interface ForgotPasswordScreenProps {
 const { width, height } = Dimensions.get('window');
 
 const ForgotPasswordScreen: React.FC<ForgotPasswordScreenProps> = ({ navigation }) => {
-  const { t, getCurrentLanguage } = useTranslation();
+  const { t, getCurrentLanguage } = useTranslation('auth');
   const [identifier, setIdentifier] = useState('');
   const [loading, setLoading] = useState(false);
   const [errors, setErrors] = useState<{ identifier?: string; otp?: string }>({});
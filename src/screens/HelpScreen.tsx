@@ -73,7 +73,7 @@ const HelpScreen = () => {
   const navigation = useNavigation();
   const [expandedCategory, setExpandedCategory] = React.useState<string | null>(null);
   const [expandedQuestion, setExpandedQuestion] = React.useState<string | null>(null);
-  const { t } = useTranslation();
+  const { t } = useTranslation('account');
 
   return (
     <SafeAreaView style={styles.container}>
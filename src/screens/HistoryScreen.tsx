@@ -1,15 +1,17 @@
-import React, { useState, useEffect } from 'react';
+import React, { memo, useCallback, useState, useEffect, useMemo } from 'react';
 import {
   View,
   Text,
   StyleSheet,
   ScrollView,
+  FlatList,
   TouchableOpacity,
   SafeAreaView,
   Platform,
   Modal,
   Dimensions,
   Alert,
+  TextInput,
 } from 'react-native';
 import Icon from 'react-native-vector-icons/MaterialCommunityIcons';
 import { theme } from '../theme/colors';
@@ -18,7 +20,22 @@ import {
   widthPercentageToDP as wp,
   heightPercentageToDP as hp,
 } from 'react-native-responsive-screen';
-import api from '../utils/Api';
+import DatePickerLib from 'react-native-date-picker';
+import { bucketOf, StatusBucket, useTransactionStore } from '../socket/transactionStore';
+import { searchTransactions } from '../socket/transactionSearch';
+import { getRowView } from '../utils/historyRows';
+import {
+  dayRange,
+  idsInRange,
+  monthRange,
+  presetRange,
+  TimeRange,
+  toDayString,
+} from '../utils/timeIndex';
+import { TransactionSyncService, VerificationRequiredError } from '../services/TransactionSyncService';
+import { SocketManager } from '../socket/connectionManager';
+import { QueryCache } from '../utils/queryCache';
+import { bankAccountsQuery, pendingTransactionQuery, successTransactionQuery } from '../utils/queries';
 import LoadingOverlay from '../component/LoadingOverlay';
 import { useTranslation } from '../hooks/useTranslation';
 
@@ -46,11 +63,6 @@ interface Transaction {
   created_at: string;
 }
 
-interface TransactionHistoryResponse {
-  status: boolean;
-  data: Transaction[];
-}
-
 
 
 const TIME_FILTERS = [
@@ -60,8 +72,287 @@ const TIME_FILTERS = [
   { id: '6m', label: '6 Months' },
 ];
 
+// Which part of the filter modal was touched last decides the range on confirm
+type FilterSource = 'preset' | 'range' | 'month';
+
+const keyExtractor = (item: Transaction) => String(item.id);
+
+type RowProps = {
+  transaction: Transaction;
+  t: ReturnType<typeof useTranslation>['t'];
+  navigation: any;
+};
+
+// Render success transaction view
+const SuccessRow = memo(({ transaction, t, navigation }: RowProps) => {
+  const isBuy = transaction.type === 1; // 1 = buy, 2 = sell
+  // Formatted once per transaction object, not per render
+  const { amount, exchangeAmount, date, time, rate, fee } = getRowView(transaction);
+
+  return (
+    <TouchableOpacity
+      style={[styles.transactionItem, styles.successTransactionItem]}
+      onPressIn={() => {
+        // The detail screen refreshes the row from this request
+        const transactionType = transaction.type === 1 ? 'buy' : 'sell';
+        QueryCache.prefetch(successTransactionQuery(transactionType, transaction.id));
+      }}
+      onPress={() => {
+        const transactionType = transaction.type === 1 ? 'buy' : 'sell';
+        (navigation as any).navigate('SuccessTransactionDetail', { 
+          transaction: transaction,
+          idTransaction: transaction.id, 
+          type: transactionType 
+        });
+      }}
+    >
+      <View style={styles.transactionContent}>
+        <View style={styles.transactionHeader}>
+          <View style={styles.transactionTitleContainer}>
+            <View style={[styles.iconContainer, { backgroundColor: '#E8F5E8' }]}>
+              <Icon
+                name="check-circle"
+                size={20}
+                color="#34C759"
+              />
+            </View>
+            <View>
+              <Text style={styles.transactionType}>
+                {isBuy ? t('history.buyUsdt') : t('history.sellUsdt')} - {t('history.completed')}
+              </Text>
+              <Text style={styles.transactionDate}>
+                {date} • {time}
+              </Text>
+            </View>
+          </View>
+          <View style={styles.statusContainer}>
+            <View style={[styles.statusDot, { backgroundColor: '#34C759' }]} />
+            <Text style={[styles.transactionStatus, { color: '#34C759' }]}>
+              {t('history.success')}
+            </Text>
+          </View>
+        </View>
+
+        <View style={[styles.amountContainer, styles.successAmountContainer]}>
+          <View style={styles.amountRow}>
+            <Text style={styles.amountLabel}>{isBuy ? t('history.amountPaid') : t('history.amountReceived')}</Text>
+            <Text style={[styles.amountValue, { color: '#34C759' }]}>
+              {amount}
+            </Text>
+          </View>
+          <View style={styles.amountRow}>
+            <Text style={styles.amountLabel}>{isBuy ? t('history.usdtReceived') : t('history.usdtSold')}</Text>
+            <Text style={[styles.exchangeValue, { color: '#34C759' }]}>{exchangeAmount}</Text>
+          </View>
+          <View style={styles.amountRow}>
+            <Text style={styles.amountLabel}>{t('history.exchangeRate')}</Text>
+            <Text style={styles.exchangeRateValue}>
+              {rate}
+            </Text>
+          </View>
+          <View style={styles.amountRow}>
+            <Text style={styles.amountLabel}>{t('history.transactionFee')}</Text>
+            <Text style={styles.exchangeRateValue}>
+              {fee}
+            </Text>
+          </View>
+        </View>
+      </View>
+    </TouchableOpacity>
+  );
+});
+
+// Render failed transaction view
+const FailedRow = memo(({ transaction, t, navigation }: RowProps) => {
+  const isBuy = transaction.type === 1; // 1 = buy, 2 = sell
+  // Formatted once per transaction object, not per render
+  const { amount, exchangeAmount, date, time, rate, fee } = getRowView(transaction);
+
+  return (
+    <TouchableOpacity
+      style={[
+        styles.transactionItem, 
+        transaction.status === 2 ? styles.failedTransactionItem : styles.waitingConfirmTransactionItem
+      ]}
+      // onPress={() => {
+      //   const transactionType = transaction.type === 1 ? 'buy' : 'sell';
+      //     // For failed transactions
+      //     (navigation as any).navigate('FailedTransactionDetail', { 
+      //       transaction: transaction,
+      //       idTransaction: transaction.id, 
+      //       type: transactionType 
+      //     });
+      // }}
+    >
+      <View style={styles.transactionContent}>
+        <View style={styles.transactionHeader}>
+          <View style={styles.transactionTitleContainer}>
+            <View style={[styles.iconContainer, { 
+              backgroundColor: transaction.status === 2 ? '#FFEBEE' : '#FFF4E6'
+            }]}>
+              <Icon
+                name={transaction.status === 2 ? "close-circle" : "clock-outline"}
+                size={20}
+                color={transaction.status === 2 ? "#FF3B30" : "#FF9500"}
+              />
+            </View>
+            <View style={styles.transactionInfo}>
+              <Text style={styles.transactionType}>
+                {isBuy ? t('history.buyUsdt') : t('history.sellUsdt')} - {
+                  transaction.status === 2 ? t('history.failed') :
+                  transaction.status === 3 ? t('history.waitingBuyConfirm') :
+                  transaction.status === 4 ? t('history.waitingSellConfirm') :
+                  t('history.failed')
+                }
+              </Text>
+              <Text style={styles.transactionDate}>
+                {date} • {time}
+              </Text>
+            </View>
+          </View>
+          <View style={styles.statusContainer}>
+            <View style={[styles.statusDot, { 
+              backgroundColor: transaction.status === 2 ? '#FF3B30' : '#FF9500'
+            }]} />
+            <Text style={[styles.transactionStatus, { 
+              color: transaction.status === 2 ? '#FF3B30' : '#FF9500'
+            }]}>
+              {transaction.status === 2 ? t('history.failed') :
+               transaction.status === 3 ? "" :
+               transaction.status === 4 ? "" :
+               t('history.failed')}
+            </Text>
+          </View>
+        </View>
+
+        <View style={[
+          styles.amountContainer, 
+          transaction.status === 2 ? styles.failedAmountContainer : styles.waitingConfirmAmountContainer
+        ]}>
+          <View style={styles.amountRow}>
+            <Text style={styles.amountLabel}>{isBuy ? t('history.amountToPay') : t('history.amountToReceive')}</Text>
+            <Text style={[styles.amountValue, { 
+              color: transaction.status === 2 ? '#FF3B30' : '#FF9500'
+            }]}>
+              {amount}
+            </Text>
+          </View>
+          <View style={styles.amountRow}>
+            <Text style={styles.amountLabel}>{isBuy ? t('history.usdtToReceive') : t('history.usdtToSell')}</Text>
+            <Text style={[styles.exchangeValue, { 
+              color: transaction.status === 2 ? '#FF3B30' : '#FF9500'
+            }]}>{exchangeAmount}</Text>
+          </View>
+          <View style={styles.amountRow}>
+            <Text style={styles.amountLabel}>{t('history.exchangeRate')}</Text>
+            <Text style={styles.exchangeRateValue}>
+              {rate}
+            </Text>
+          </View>
+          <View style={styles.amountRow}>
+            <Text style={styles.amountLabel}>{t('history.transactionFee')}</Text>
+            <Text style={styles.exchangeRateValue}>
+              {fee}
+            </Text>
+          </View>
+        </View>
+      </View>
+    </TouchableOpacity>
+  );
+});
+
+// Render pending transaction view (original logic)
+const PendingRow = memo(({ transaction, t, navigation }: RowProps) => {
+  const isBuy = transaction.type === 1; // 1 = buy, 2 = sell
+  // Formatted once per transaction object, not per render
+  const { amount, exchangeAmount, date, time, rate, fee } = getRowView(transaction);
+
+  return (
+    <TouchableOpacity
+      style={[styles.transactionItem, styles.pendingTransactionItem]}
+      onPressIn={() => {
+        // Start DetailHistory's requests before the tap completes
+        const transactionType = transaction.type === 1 ? 'buy' : 'sell';
+        QueryCache.prefetch(pendingTransactionQuery(transactionType, transaction.id), bankAccountsQuery);
+      }}
+      onPress={() => {
+        const transactionType = transaction.type === 1 ? 'buy' : 'sell';
+        (navigation as any).navigate('DetailHistory', { 
+          idTransaction: transaction.id, 
+          type: transactionType 
+        });
+      }}
+    >
+      <View style={styles.transactionContent}>
+        <View style={styles.transactionHeader}>
+          <View style={styles.transactionTitleContainer}>
+            <View style={[styles.iconContainer, { backgroundColor: isBuy ? '#E8F4FD' : '#F0EFFF' }]}>
+              <Icon
+                name={isBuy ? 'arrow-down' : 'arrow-up'}
+                size={20}
+                color={isBuy ? '#4A90E2' : '#7B68EE'}
+              />
+            </View>
+            <View>
+              <Text style={styles.transactionType}>
+                {isBuy ? t('history.buyUsdt') : t('history.sellUsdt')} - {t('history.processing')}
+              </Text>
+              <Text style={styles.transactionDate}>
+                {date} • {time}
+              </Text>
+            </View>
+          </View>
+          <View style={styles.statusContainer}>
+            <View style={[styles.statusDot, { backgroundColor: '#FF9500' }]} />
+            <Text style={[styles.transactionStatus, { color: '#FF9500' }]}>
+              {t('history.pending')}
+            </Text>
+          </View>
+        </View>
+
+        <View style={[styles.amountContainer, styles.pendingAmountContainer]}>
+          <View style={styles.amountRow}>
+            <Text style={styles.amountLabel}>{isBuy ? t('history.totalToPay') : t('history.totalToReceive')}</Text>
+            <Text style={[styles.amountValue, { color: isBuy ? '#4A90E2' : '#7B68EE' }]}>
+              {amount}
+            </Text>
+          </View>
+          <View style={styles.amountRow}>
+            <Text style={styles.amountLabel}>{isBuy ? t('history.usdtToReceive') : t('history.usdtToSell')}</Text>
+            <Text style={styles.exchangeValue}>{exchangeAmount}</Text>
+          </View>
+          <View style={styles.amountRow}>
+            <Text style={styles.amountLabel}>{t('history.exchangeRate')}</Text>
+            <Text style={styles.exchangeRateValue}>
+              {rate}
+            </Text>
+          </View>
+          <View style={styles.amountRow}>
+            <Text style={styles.amountLabel}>{t('history.transactionFee')}</Text>
+            <Text style={styles.exchangeRateValue}>
+              {fee}
+            </Text>
+          </View>
+        </View>
+      </View>
+    </TouchableOpacity>
+  );
+});
+
+// Memoized on the record object: the store keeps unchanged records' identity across
+// syncs and events (reuse() in transactionStore), so only changed rows re-render
+const TransactionRow = memo(({ transaction, t, navigation }: RowProps) => {
+  if (transaction.status === 1) {
+    return <SuccessRow transaction={transaction} t={t} navigation={navigation} />;
+  } else if (transaction.status === 2 || transaction.status === 3 || transaction.status === 4) {
+    return <FailedRow transaction={transaction} t={t} navigation={navigation} />;
+  }
+  // Pending, and the fallback for unknown statuses
+  return <PendingRow transaction={transaction} t={t} navigation={navigation} />;
+});
+
 const HistoryScreen = () => {
-  const { t } = useTranslation();
+  const { t } = useTranslation('history');
   const navigation = useNavigation();
   const [activeTab, setActiveTab] = useState<'pending' | 'success' | 'fail'>('pending');
   const [showFilterModal, setShowFilterModal] = useState(false);
@@ -70,36 +361,67 @@ const HistoryScreen = () => {
   const [selectedEndDate, setSelectedEndDate] = useState('2025-09-13');
   const [selectedMonth, setSelectedMonth] = useState(9);
   const [selectedYear, setSelectedYear] = useState(2025);
+  const [filterSource, setFilterSource] = useState<FilterSource>('preset');
+  const [pickingDate, setPickingDate] = useState<'start' | 'end' | null>(null);
+  // Applied on confirm; null shows the whole history
+  const [appliedRange, setAppliedRange] = useState<TimeRange | null>(null);
+  const [searchQuery, setSearchQuery] = useState('');
   
   // API state management
-  const [transactions, setTransactions] = useState<Transaction[]>([]);
+  // Normalized store, also patched by socket transfer events
+  // Status buckets are maintained by the store, so tabs never re-filter the full history
+  const buckets = useTransactionStore((s) => s.buckets);
+  const byId = useTransactionStore((s) => s.byId);
+  const timeline = useTransactionStore((s) => s.timeline);
+  // Ids matching the search box, from the on-device index; null when empty
+  const matches = useMemo(
+    () => searchTransactions(searchQuery),
+    // byId: re-query once newly synced rows are indexed
+    [searchQuery, byId],
+  );
+  // Filters and search are answered from local rows; a date range is two binary searches
+  const { currentTransactions, counts } = useMemo(() => {
+    if (!appliedRange && !matches) {
+      return {
+        currentTransactions: buckets[activeTab].map((id) => byId[id] as Transaction),
+        counts: { pending: buckets.pending.length, success: buckets.success.length, fail: buckets.fail.length },
+      };
+    }
+    const candidates = appliedRange ? idsInRange(timeline, appliedRange) : timeline.ids;
+    const rangeCounts: Record<StatusBucket, number> = { pending: 0, success: 0, fail: 0 };
+    const rows: Transaction[] = [];
+    // Newest first
+    for (let i = candidates.length - 1; i >= 0; i--) {
+      if (matches && !matches.has(candidates[i])) continue;
+      const transaction = byId[candidates[i]] as Transaction;
+      const bucket = bucketOf(transaction.status);
+      if (!bucket) continue;
+      rangeCounts[bucket]++;
+      if (bucket === activeTab) rows.push(transaction);
+    }
+    return { currentTransactions: rows, counts: rangeCounts };
+  }, [appliedRange, matches, buckets, activeTab, byId, timeline]);
   const [loading, setLoading] = useState(false);
   const [error, setError] = useState<string | null>(null);
   const [needsVerification, setNeedsVerification] = useState(false);
 
-  // API call to fetch transaction history
+  // Incremental sync: the first load pages in the newest rows, later calls fetch only changes
   const fetchTransactionHistory = async () => {
-    setLoading(true);
+    // Overlay only when there is nothing local to show yet
+    setLoading(useTransactionStore.getState().ids.length === 0);
     setError(null);
     setNeedsVerification(false);
     
     try {
-      console.log('Fetching transaction history...');
-      
-      const response = await api.get<TransactionHistoryResponse>('/client/transactions/history');
-      
-      console.log('Transaction history response:', response.data);
-      
-      if (response.data.status === false) {
+      await TransactionSyncService.sync();
+    } catch (error: any) {
+      console.log('Transaction history error:', error);
+
+      if (error instanceof VerificationRequiredError) {
         setNeedsVerification(true);
         return;
       }
       
-      setTransactions(response.data.data || []);
-      
-    } catch (error: any) {
-      console.log('Transaction history error:', error);
-      
       let errorMessage = t('history.failedToLoad');
       if (error.response?.data?.message) {
         errorMessage = error.response.data.message;
@@ -114,11 +436,21 @@ const HistoryScreen = () => {
     }
   };
 
+  const loadOlderTransactions = () => {
+    if (!TransactionSyncService.hasOlder()) return;
+    TransactionSyncService.loadOlder().catch((error) => {
+      console.log('Load older transactions error:', error);
+    });
+  };
+
   // Load transaction history on component mount
   useEffect(() => {
     fetchTransactionHistory();
   }, []);
 
+  // Transfer events may have been missed while the socket was down
+  useEffect(() => SocketManager.onGap(() => fetchTransactionHistory()), []);
+
   // Reload history whenever this screen gains focus
   useEffect(() => {
     const unsubscribe = (navigation as any).addListener('focus', () => {
@@ -127,357 +459,32 @@ const HistoryScreen = () => {
     return unsubscribe;
   }, [navigation]);
 
-  // Format createdAt timestamp to Vietnamese format
-  const formatCreatedAt = (createdAt: string) => {
-    try {
-      const date = new Date(createdAt);
-      const dateStr = date.toLocaleDateString('vi-VN');
-      const timeStr = date.toLocaleTimeString('vi-VN', { 
-        hour: '2-digit', 
-        minute: '2-digit',
-        hour12: false 
-      });
-      return {
-        date: dateStr,
-        time: timeStr
-      };
-    } catch (error) {
-      console.error('Error formatting createdAt:', error);
-      // fallback to current date/time
-      const now = new Date();
-      return {
-        date: now.toLocaleDateString('vi-VN'),
-        time: now.toLocaleTimeString('vi-VN', { hour: '2-digit', minute: '2-digit' })
-      };
-    }
-  };
-
   const handleTimeFilterPress = (filterId: string) => {
     setSelectedTimeFilter(filterId);
+    setFilterSource('preset');
   };
 
   const handleFilterConfirm = () => {
-    // Handle data filtering here
+    const range = filterSource === 'month'
+      ? monthRange(selectedMonth, selectedYear)
+      : filterSource === 'range'
+        ? dayRange(selectedStartDate, selectedEndDate)
+        : presetRange(selectedTimeFilter);
+    setAppliedRange(range);
     setShowFilterModal(false);
-    // Refresh data with new filters
-    fetchTransactionHistory();
-  };
-
-  // Helper function to categorize transactions based on status
-  const categorizeTransactions = () => {
-    const pending = transactions.filter(t => t.status === 0); // pending
-    const success = transactions.filter(t => t.status === 1); // success
-    const fail = transactions.filter(t => t.status === 2 || t.status === 3 || t.status === 4); // failed, waiting buy confirm, waiting sell confirm
-    
-    return { pending, success, fail };
-  };
-
-  // Render success transaction view
-  const renderSuccessTransaction = (transaction: Transaction, index: number) => {
-    const isBuy = transaction.type === 1; // 1 = buy, 2 = sell
-    
-    // Format amounts based on transaction type
-    let amount, exchangeAmount;
-    if (isBuy) {
-      amount = `${transaction.amount_vnd_real.toLocaleString('vi-VN')} VND`;
-      exchangeAmount = `${transaction.amount_usdt} USDT`;
-    } else {
-      amount = `${transaction.amount_vnd_real.toLocaleString('vi-VN')} VND`;
-      exchangeAmount = `${transaction.amount_usdt} USDT`;
-    }
-    
-    const { date, time } = transaction.created_at 
-      ? formatCreatedAt(transaction.created_at)
-      : formatCreatedAt(new Date().toISOString());
-
-    return (
-      <TouchableOpacity
-        key={`${transaction.note}-${transaction.id}-${index}`}
-        style={[styles.transactionItem, styles.successTransactionItem]}
-        onPress={() => {
-          const transactionType = transaction.type === 1 ? 'buy' : 'sell';
-          (navigation as any).navigate('SuccessTransactionDetail', { 
-            transaction: transaction,
-            idTransaction: transaction.id, 
-            type: transactionType 
-          });
-        }}
-      >
-        <View style={styles.transactionContent}>
-          <View style={styles.transactionHeader}>
-            <View style={styles.transactionTitleContainer}>
-              <View style={[styles.iconContainer, { backgroundColor: '#E8F5E8' }]}>
-                <Icon
-                  name="check-circle"
-                  size={20}
-                  color="#34C759"
-                />
-              </View>
-              <View>
-                <Text style={styles.transactionType}>
-                  {isBuy ? t('history.buyUsdt') : t('history.sellUsdt')} - {t('history.completed')}
-                </Text>
-                <Text style={styles.transactionDate}>
-                  {date} • {time}
-                </Text>
-              </View>
-            </View>
-            <View style={styles.statusContainer}>
-              <View style={[styles.statusDot, { backgroundColor: '#34C759' }]} />
-              <Text style={[styles.transactionStatus, { color: '#34C759' }]}>
-                {t('history.success')}
-              </Text>
-            </View>
-          </View>
-
-          <View style={[styles.amountContainer, styles.successAmountContainer]}>
-            <View style={styles.amountRow}>
-              <Text style={styles.amountLabel}>{isBuy ? t('history.amountPaid') : t('history.amountReceived')}</Text>
-              <Text style={[styles.amountValue, { color: '#34C759' }]}>
-                {amount}
-              </Text>
-            </View>
-            <View style={styles.amountRow}>
-              <Text style={styles.amountLabel}>{isBuy ? t('history.usdtReceived') : t('history.usdtSold')}</Text>
-              <Text style={[styles.exchangeValue, { color: '#34C759' }]}>{exchangeAmount}</Text>
-            </View>
-            <View style={styles.amountRow}>
-              <Text style={styles.amountLabel}>{t('history.exchangeRate')}</Text>
-              <Text style={styles.exchangeRateValue}>
-                {transaction.rate ? transaction.rate.toLocaleString('vi-VN') : '0'} VND/USDT
-              </Text>
-            </View>
-            <View style={styles.amountRow}>
-              <Text style={styles.amountLabel}>{t('history.transactionFee')}</Text>
-              <Text style={styles.exchangeRateValue}>
-                {transaction.fee_vnd ? transaction.fee_vnd.toLocaleString('vi-VN') : '0'} VND ({transaction.fee_percent ? (transaction.fee_percent * 100).toFixed(2) : '0'}%)
-              </Text>
-            </View>
-          </View>
-        </View>
-      </TouchableOpacity>
-    );
-  };
-
-  // Render failed transaction view
-  const renderFailedTransaction = (transaction: Transaction, index: number) => {
-    const isBuy = transaction.type === 1; // 1 = buy, 2 = sell
-    
-    // Format amounts based on transaction type
-    let amount, exchangeAmount;
-    if (isBuy) {
-      amount = `${transaction.amount_vnd_real.toLocaleString('vi-VN')} VND`;
-      exchangeAmount = `${transaction.amount_usdt} USDT`;
-    } else {
-      amount = `${transaction.amount_vnd_real.toLocaleString('vi-VN')} VND`;
-      exchangeAmount = `${transaction.amount_usdt} USDT`;
-    }
-    
-    const { date, time } = transaction.created_at 
-      ? formatCreatedAt(transaction.created_at)
-      : formatCreatedAt(new Date().toISOString());
-
-    return (
-      <TouchableOpacity
-        key={`${transaction.note}-${transaction.id}-${index}`}
-        style={[
-          styles.transactionItem, 
-          transaction.status === 2 ? styles.failedTransactionItem : styles.waitingConfirmTransactionItem
-        ]}
-        // onPress={() => {
-        //   const transactionType = transaction.type === 1 ? 'buy' : 'sell';
-        //     // For failed transactions
-        //     (navigation as any).navigate('FailedTransactionDetail', { 
-        //       transaction: transaction,
-        //       idTransaction: transaction.id, 
-        //       type: transactionType 
-        //     });
-        // }}
-      >
-        <View style={styles.transactionContent}>
-          <View style={styles.transactionHeader}>
-            <View style={styles.transactionTitleContainer}>
-              <View style={[styles.iconContainer, { 
-                backgroundColor: transaction.status === 2 ? '#FFEBEE' : '#FFF4E6'
-              }]}>
-                <Icon
-                  name={transaction.status === 2 ? "close-circle" : "clock-outline"}
-                  size={20}
-                  color={transaction.status === 2 ? "#FF3B30" : "#FF9500"}
-                />
-              </View>
-              <View style={styles.transactionInfo}>
-                <Text style={styles.transactionType}>
-                  {isBuy ? t('history.buyUsdt') : t('history.sellUsdt')} - {
-                    transaction.status === 2 ? t('history.failed') :
-                    transaction.status === 3 ? t('history.waitingBuyConfirm') :
-                    transaction.status === 4 ? t('history.waitingSellConfirm') :
-                    t('history.failed')
-                  }
-                </Text>
-                <Text style={styles.transactionDate}>
-                  {date} • {time}
-                </Text>
-              </View>
-            </View>
-            <View style={styles.statusContainer}>
-              <View style={[styles.statusDot, { 
-                backgroundColor: transaction.status === 2 ? '#FF3B30' : '#FF9500'
-              }]} />
-              <Text style={[styles.transactionStatus, { 
-                color: transaction.status === 2 ? '#FF3B30' : '#FF9500'
-              }]}>
-                {transaction.status === 2 ? t('history.failed') :
-                 transaction.status === 3 ? "" :
-                 transaction.status === 4 ? "" :
-                 t('history.failed')}
-              </Text>
-            </View>
-          </View>
-
-          <View style={[
-            styles.amountContainer, 
-            transaction.status === 2 ? styles.failedAmountContainer : styles.waitingConfirmAmountContainer
-          ]}>
-            <View style={styles.amountRow}>
-              <Text style={styles.amountLabel}>{isBuy ? t('history.amountToPay') : t('history.amountToReceive')}</Text>
-              <Text style={[styles.amountValue, { 
-                color: transaction.status === 2 ? '#FF3B30' : '#FF9500'
-              }]}>
-                {amount}
-              </Text>
-            </View>
-            <View style={styles.amountRow}>
-              <Text style={styles.amountLabel}>{isBuy ? t('history.usdtToReceive') : t('history.usdtToSell')}</Text>
-              <Text style={[styles.exchangeValue, { 
-                color: transaction.status === 2 ? '#FF3B30' : '#FF9500'
-              }]}>{exchangeAmount}</Text>
-            </View>
-            <View style={styles.amountRow}>
-              <Text style={styles.amountLabel}>{t('history.exchangeRate')}</Text>
-              <Text style={styles.exchangeRateValue}>
-                {transaction.rate ? transaction.rate.toLocaleString('vi-VN') : '0'} VND/USDT
-              </Text>
-            </View>
-            <View style={styles.amountRow}>
-              <Text style={styles.amountLabel}>{t('history.transactionFee')}</Text>
-              <Text style={styles.exchangeRateValue}>
-                {transaction.fee_vnd ? transaction.fee_vnd.toLocaleString('vi-VN') : '0'} VND ({transaction.fee_percent ? (transaction.fee_percent * 100).toFixed(2) : '0'}%)
-              </Text>
-            </View>
-          </View>
-        </View>
-      </TouchableOpacity>
-    );
-  };
-
-  // Render pending transaction view (original logic)
-  const renderPendingTransaction = (transaction: Transaction, index: number) => {
-    const isBuy = transaction.type === 1; // 1 = buy, 2 = sell
-    
-    // Format amounts based on transaction type
-    let amount, exchangeAmount;
-    if (isBuy) {
-      amount = `${transaction.amount_vnd_real.toLocaleString('vi-VN')} VND`;
-      exchangeAmount = `${transaction.amount_usdt} USDT`;
-    } else {
-      amount = `${transaction.amount_vnd_real.toLocaleString('vi-VN')} VND`;
-      exchangeAmount = `${transaction.amount_usdt} USDT`;
-    }
-    
-    const { date, time } = transaction.created_at 
-      ? formatCreatedAt(transaction.created_at)
-      : formatCreatedAt(new Date().toISOString());
-
-    return (
-      <TouchableOpacity
-        key={`${transaction.note}-${transaction.id}-${index}`}
-        style={[styles.transactionItem, styles.pendingTransactionItem]}
-        onPress={() => {
-          const transactionType = transaction.type === 1 ? 'buy' : 'sell';
-          (navigation as any).navigate('DetailHistory', { 
-            idTransaction: transaction.id, 
-            type: transactionType 
-          });
-        }}
-      >
-        <View style={styles.transactionContent}>
-          <View style={styles.transactionHeader}>
-            <View style={styles.transactionTitleContainer}>
-              <View style={[styles.iconContainer, { backgroundColor: isBuy ? '#E8F4FD' : '#F0EFFF' }]}>
-                <Icon
-                  name={isBuy ? 'arrow-down' : 'arrow-up'}
-                  size={20}
-                  color={isBuy ? '#4A90E2' : '#7B68EE'}
-                />
-              </View>
-              <View>
-                <Text style={styles.transactionType}>
-                  {isBuy ? t('history.buyUsdt') : t('history.sellUsdt')} - {t('history.processing')}
-                </Text>
-                <Text style={styles.transactionDate}>
-                  {date} • {time}
-                </Text>
-              </View>
-            </View>
-            <View style={styles.statusContainer}>
-              <View style={[styles.statusDot, { backgroundColor: '#FF9500' }]} />
-              <Text style={[styles.transactionStatus, { color: '#FF9500' }]}>
-                {t('history.pending')}
-              </Text>
-            </View>
-          </View>
-
-          <View style={[styles.amountContainer, styles.pendingAmountContainer]}>
-            <View style={styles.amountRow}>
-              <Text style={styles.amountLabel}>{isBuy ? t('history.totalToPay') : t('history.totalToReceive')}</Text>
-              <Text style={[styles.amountValue, { color: isBuy ? '#4A90E2' : '#7B68EE' }]}>
-                {amount}
-              </Text>
-            </View>
-            <View style={styles.amountRow}>
-              <Text style={styles.amountLabel}>{isBuy ? t('history.usdtToReceive') : t('history.usdtToSell')}</Text>
-              <Text style={styles.exchangeValue}>{exchangeAmount}</Text>
-            </View>
-            <View style={styles.amountRow}>
-              <Text style={styles.amountLabel}>{t('history.exchangeRate')}</Text>
-              <Text style={styles.exchangeRateValue}>
-                {transaction.rate ? transaction.rate.toLocaleString('vi-VN') : '0'} VND/USDT
-              </Text>
-            </View>
-            <View style={styles.amountRow}>
-              <Text style={styles.amountLabel}>{t('history.transactionFee')}</Text>
-              <Text style={styles.exchangeRateValue}>
-                {transaction.fee_vnd ? transaction.fee_vnd.toLocaleString('vi-VN') : '0'} VND ({transaction.fee_percent ? (transaction.fee_percent * 100).toFixed(2) : '0'}%)
-              </Text>
-            </View>
-          </View>
-        </View>
-      </TouchableOpacity>
-    );
-  };
-
-  // Main render function that chooses the appropriate view
-  const renderTransaction = (transaction: Transaction, index: number) => {
-    if (transaction.status === 0) {
-      return renderPendingTransaction(transaction, index);
-    } else if (transaction.status === 1) {
-      return renderSuccessTransaction(transaction, index);
-    } else if (transaction.status === 2 || transaction.status === 3 || transaction.status === 4) {
-      return renderFailedTransaction(transaction, index);
-    } else {
-      // Fallback to pending for unknown status
-      return renderPendingTransaction(transaction, index);
-    }
+    // Hits the server only when the range starts before the rows synced so far
+    TransactionSyncService.ensureSince(range.from).catch((error) => {
+      console.log('Load history range error:', error);
+    });
   };
 
-  const getCurrentTransactions = () => {
-    const categorized = categorizeTransactions();
-    return categorized[activeTab] || [];
-  };
+  // Stable across renders, so memoized rows only re-render when their record changes
+  const renderItem = useCallback(
+    ({ item }: { item: Transaction }) => <TransactionRow transaction={item} t={t} navigation={navigation} />,
+    [t, navigation],
+  );
 
   const renderEmptyState = () => {
-    const counts = categorizeTransactions();
     const isPending = activeTab === 'pending';
     const isSuccess = activeTab === 'success';
     const isFail = activeTab === 'fail';
@@ -508,8 +515,13 @@ const HistoryScreen = () => {
       bgColor = '#FFEBEE';
     }
 
-    // Only show when the active tab has zero items
-    if (getCurrentTransactions().length > 0) return null;
+    if (matches) {
+      title = t('history.noSearchResults');
+      description = t('history.noSearchResultsDesc');
+      iconName = 'magnify';
+      iconColor = '#999999';
+      bgColor = '#F2F2F7';
+    }
 
     return (
       <View style={styles.emptyContainer}>
@@ -584,6 +596,26 @@ const HistoryScreen = () => {
         renderVerificationRequired()
       ) : (
         <>
+          <View style={styles.searchContainer}>
+            <Icon name="magnify" size={20} color="#8E8E93" />
+            <TextInput
+              style={styles.searchInput}
+              value={searchQuery}
+              onChangeText={setSearchQuery}
+              placeholder={t('history.searchPlaceholder')}
+              placeholderTextColor="#8E8E93"
+              autoCapitalize="none"
+              autoCorrect={false}
+              clearButtonMode="while-editing"
+              returnKeyType="search"
+            />
+            {searchQuery.length > 0 && Platform.OS === 'android' && (
+              <TouchableOpacity onPress={() => setSearchQuery('')}>
+                <Icon name="close-circle" size={18} color="#8E8E93" />
+              </TouchableOpacity>
+            )}
+          </View>
+
           {/* Tab Navigation */}
           <View style={styles.tabContainer}>
             <TouchableOpacity
@@ -607,7 +639,7 @@ const HistoryScreen = () => {
                   styles.tabBadgeText, 
                   activeTab === 'pending' && [styles.tabBadgeTextActive, styles.tabBadgeTextPending]
                 ]}>
-                  {categorizeTransactions().pending.length}
+                  {counts.pending}
                 </Text>
               </View>
             </TouchableOpacity>
@@ -633,7 +665,7 @@ const HistoryScreen = () => {
                   styles.tabBadgeText, 
                   activeTab === 'success' && [styles.tabBadgeTextActive, styles.tabBadgeTextSuccess]
                 ]}>
-                  {categorizeTransactions().success.length}
+                  {counts.success}
                 </Text>
               </View>
             </TouchableOpacity>
@@ -659,25 +691,27 @@ const HistoryScreen = () => {
                   styles.tabBadgeText, 
                   activeTab === 'fail' && [styles.tabBadgeTextActive, styles.tabBadgeTextFail]
                 ]}>
-                  {categorizeTransactions().fail.length}
+                  {counts.fail}
                 </Text>
               </View>
             </TouchableOpacity>
           </View>
 
-          <ScrollView
+          <FlatList
             style={styles.content}
+            data={currentTransactions}
+            renderItem={renderItem}
+            keyExtractor={keyExtractor}
+            ListEmptyComponent={renderEmptyState}
+            onEndReached={loadOlderTransactions}
+            onEndReachedThreshold={0.5}
             showsVerticalScrollIndicator={false}
             contentContainerStyle={styles.scrollContent}
-          >
-            {getCurrentTransactions().length === 0 ? (
-              renderEmptyState()
-            ) : (
-              <View style={styles.transactionList}>
-                {getCurrentTransactions().map((transaction, index) => renderTransaction(transaction, index))}
-              </View>
-            )}
-          </ScrollView>
+            initialNumToRender={8}
+            maxToRenderPerBatch={8}
+            windowSize={7}
+            removeClippedSubviews={Platform.OS === 'android'}
+          />
         </>
       )}
 
@@ -722,11 +756,11 @@ const HistoryScreen = () => {
             </View>
 
             <View style={styles.dateRangeContainer}>
-              <TouchableOpacity style={styles.dateInput}>
+              <TouchableOpacity style={styles.dateInput} onPress={() => setPickingDate('start')}>
                 <Text style={styles.dateInputText}>{selectedStartDate}</Text>
               </TouchableOpacity>
               <Text style={styles.dateRangeSeparator}>to</Text>
-              <TouchableOpacity style={styles.dateInput}>
+              <TouchableOpacity style={styles.dateInput} onPress={() => setPickingDate('end')}>
                 <Text style={styles.dateInputText}>{selectedEndDate}</Text>
               </TouchableOpacity>
             </View>
@@ -744,7 +778,10 @@ const HistoryScreen = () => {
                       styles.monthButton,
                       selectedMonth === month && styles.monthButtonActive
                     ]}
-                    onPress={() => setSelectedMonth(month)}
+                    onPress={() => {
+                      setSelectedMonth(month);
+                      setFilterSource('month');
+                    }}
                   >
                     <Text style={[
                       styles.monthButtonText,
@@ -768,7 +805,10 @@ const HistoryScreen = () => {
                       styles.yearButton,
                       selectedYear === year && styles.yearButtonActive
                     ]}
-                    onPress={() => setSelectedYear(year)}
+                    onPress={() => {
+                      setSelectedYear(year);
+                      setFilterSource('month');
+                    }}
                   >
                     <Text style={[
                       styles.yearButtonText,
@@ -781,6 +821,20 @@ const HistoryScreen = () => {
               </ScrollView>
             </View>
 
+            <DatePickerLib
+              modal
+              open={pickingDate !== null}
+              date={new Date(`${pickingDate === 'end' ? selectedEndDate : selectedStartDate}T00:00:00`)}
+              mode="date"
+              onConfirm={(date) => {
+                if (pickingDate === 'end') setSelectedEndDate(toDayString(date));
+                else setSelectedStartDate(toDayString(date));
+                setFilterSource('range');
+                setPickingDate(null);
+              }}
+              onCancel={() => setPickingDate(null)}
+            />
+
             <View style={styles.modalFooter}>
               <TouchableOpacity 
                 style={styles.resetButton}
@@ -790,6 +844,8 @@ const HistoryScreen = () => {
                   setSelectedEndDate('2025-09-13');
                   setSelectedMonth(9);
                   setSelectedYear(2025);
+                  setFilterSource('preset');
+                  setAppliedRange(null);
                 }}
               >
                 <Text style={styles.resetButtonText}>{t('history.reset')}</Text>
@@ -837,6 +893,22 @@ const styles = StyleSheet.create({
   filterButton: {
     padding: 8,
   },
+  searchContainer: {
+    flexDirection: 'row',
+    alignItems: 'center',
+    backgroundColor: '#F8F8F8',
+    marginHorizontal: 20,
+    marginBottom: 12,
+    paddingHorizontal: 12,
+    borderRadius: 12,
+    gap: 8,
+  },
+  searchInput: {
+    flex: 1,
+    paddingVertical: Platform.OS === 'ios' ? 12 : 8,
+    fontSize: 15,
+    color: '#000',
+  },
   tabContainer: {
     flexDirection: 'row',
     backgroundColor: '#F8F8F8',
@@ -943,9 +1015,6 @@ const styles = StyleSheet.create({
     paddingHorizontal: 20,
     paddingBottom: 20,
   },
-  transactionList: {
-    gap: 12,
-  },
   transactionItem: {
     backgroundColor: '#FFFFFF',
     borderRadius: 16,
@@ -1,4 +1,4 @@
-import React, { useState, useEffect } from 'react';
+import React, { useState, useEffect, useRef, useMemo } from 'react';
 import {
   View,
   Text,
@@ -20,13 +20,40 @@ import {
   widthPercentageToDP as wp,
   heightPercentageToDP as hp,
 } from 'react-native-responsive-screen';
-import api from '../utils/Api';
+import api, { batcher } from '../utils/Api';
 import { useTranslation } from '../hooks/useTranslation';
+import { ResponseCache } from '../utils/responseCache';
+import { markTimeToContent } from '../utils/startupMetrics';
+import { QueryCache } from '../utils/queryCache';
+import { formatUSDT, formatVND, numberFormat } from '../utils/format';
+import {
+  type EntryRule,
+  RATE_SCALE,
+  USDT_ENTRY,
+  USDT_SCALE,
+  VND_ENTRY,
+  deleteKey,
+  emptyEntry,
+  entryFromText,
+  formatUnits,
+  fromNumber,
+  parseDecimal,
+  pressKey,
+  usdtToVnd,
+  vndToUsdt,
+} from '../utils/money';
+import { ExchangeRateService, useExchangeRateStore } from '../services/ExchangeRateService';
+import RateCountdown from '../component/RateCountdown';
+import { bankAccountsQuery, walletsQuery } from '../utils/queries';
 
 const { width } = Dimensions.get('window');
 
-const MAX_VND_AMOUNT = 999999999999; // 1 tỷ VND
-const MAX_USDT_AMOUNT = 999999.99; // 1 triệu USDT
+const MAX_VND_AMOUNT = BigInt(999999999999); // 1 tỷ VND
+const MAX_USDT_AMOUNT = parseDecimal('999999.99', USDT_SCALE)!; // 1 triệu USDT
+
+// Buy enters VND and sell enters USDT; swapped, each enters what it receives
+const entryRuleFor = (tab: 'buy' | 'sell', swapped: boolean): EntryRule =>
+  (tab === 'buy') !== swapped ? VND_ENTRY : USDT_ENTRY;
 
 // Fallback rate nếu API fail
 const FALLBACK_RATE = 26450;
@@ -36,10 +63,10 @@ const formatMoney = (amount: string | number) => {
   if (isNaN(num)) return '0';
 
   // Giới hạn số chữ số thập phân
-  const formatted = num.toLocaleString('vi-VN', {
+  const formatted = numberFormat('vi-VN', {
     maximumFractionDigits: 2,
     minimumFractionDigits: 0
-  });
+  }).format(num);
 
 
   return formatted;
@@ -48,10 +75,7 @@ const formatMoney = (amount: string | number) => {
 const formatNumber = (num: string | number) => {
   const value = typeof num === 'string' ? parseFloat(num) : num;
   if (isNaN(value)) return '0.00';
-  return value.toLocaleString('en-US', {
-    minimumFractionDigits: 2,
-    maximumFractionDigits: 2,
-  });
+  return formatUSDT(value);
 };
 
 interface UserProfile {
@@ -91,13 +115,15 @@ interface BankAccountData {
 
 const HomeScreen: StackScreen<'Home'> = () => {
   const navigation = useNavigation();
-  const { t } = useTranslation();
+  const { t } = useTranslation(['home', 'bank', 'ekyc']);
   const [activeTab, setActiveTab] = useState<'buy' | 'sell'>('buy');
-  const [amount, setAmount] = useState('');
-  const [binanceRate, setBinanceRate] = useState(0);
+  // Amount on the keypad, kept as exact units with its display string
+  const [entry, setEntry] = useState(() => emptyEntry(VND_ENTRY));
+  // Shared feed: only changes of the rate itself re-render the screen
+  const binanceRate = useExchangeRateStore((s) => s.rate) || FALLBACK_RATE;
+  const rateUnits = useMemo(() => fromNumber(binanceRate, RATE_SCALE) ?? BigInt(0), [binanceRate]);
+  const isLoadingRate = useExchangeRateStore((s) => s.isLoading);
   const [isSwapped, setIsSwapped] = useState(false); // true = nhập số muốn nhận, false = nhập số muốn đổi
-  const [countdown, setCountdown] = useState(20); // Countdown 20 giây
-  const [isLoadingRate, setIsLoadingRate] = useState(false);
   const [userProfile, setUserProfile] = useState<UserProfile | null>(null);
   const [isLoadingProfile, setIsLoadingProfile] = useState(true);
   const [hasTRC20Wallet, setHasTRC20Wallet] = useState(false);
@@ -106,13 +132,16 @@ const HomeScreen: StackScreen<'Home'> = () => {
   const [isLoadingBanks, setIsLoadingBanks] = useState(true);
   const [isInitialLoading, setIsInitialLoading] = useState(true);
   const [isRefreshing, setIsRefreshing] = useState(false);
+  // True once something real (cached or fresh) is on screen
+  const hasContentRef = useRef(false);
 
   // Function to fetch user profile
   const fetchUserProfile = async () => {
     try {
-      const response = await api.get('/client/profile');
+      const response = await batcher.get('/client/profile');
       if (response.data.status) {
         setUserProfile(response.data.data);
+        ResponseCache.put('/client/profile', response.data);
       }
     } catch (error) {
       console.log('Profile fetch error:', error);
@@ -125,10 +154,11 @@ const HomeScreen: StackScreen<'Home'> = () => {
   const fetchTRC20Wallets = async () => {
     try {
       setIsLoadingWallets(true);
-      const response = await api.get('/client/wallet/data');
+      const response = await batcher.get('/client/wallet/data');
       if (response.data.status) {
         const walletData: WalletData[] = response.data.data;
         setHasTRC20Wallet(walletData.length > 0);
+        ResponseCache.put('/client/wallet/data', response.data);
       } else {
         setHasTRC20Wallet(false);
       }
@@ -144,10 +174,11 @@ const HomeScreen: StackScreen<'Home'> = () => {
   const fetchBankAccounts = async () => {
     try {
       setIsLoadingBanks(true);
-      const response = await api.get('/client/bank/data');
+      const response = await batcher.get('/client/bank/data');
       if (response.data.status) {
         const accountData: BankAccountData[] = response.data.data;
         setHasBankAccount(accountData.length > 0);
+        ResponseCache.put('/client/bank/data', response.data);
       } else {
         setHasBankAccount(false);
       }
@@ -159,63 +190,48 @@ const HomeScreen: StackScreen<'Home'> = () => {
     }
   };
 
-  // Function to fetch rate from your backend API
-  const fetchExchangeRate = async () => {
-    setIsLoadingRate(true);
-    
-    try {
-      const response = await api.get('/client/exchange/rate');
-      const data = response.data;
-      
-      console.log('Exchange rate response:', data);
-      
-      // API trả về format: { "rate": 26450 }
-      if (data.rate && !isNaN(parseFloat(data.rate))) {
-        setBinanceRate(parseFloat(data.rate));
-        console.log('Rate updated from API:', data.rate);
-      } else {
-        throw new Error('Invalid rate format');
-      }
-    } catch (error) {
-      // console.log('API failed, using fallback rate:', error);
-      setBinanceRate(FALLBACK_RATE);
-    } finally {
-      setIsLoadingRate(false);
-    }
-  };
-
-  // Chỉ poll mỗi 20s khi màn hình đang focus
+  // Chỉ nhận tỷ giá khi màn hình đang focus
   useFocusEffect(
-    React.useCallback(() => {
-      // Reset countdown và fetch ngay khi focus
-      setCountdown(20);
-      fetchExchangeRate();
-
-      const countdownInterval = setInterval(() => {
-        setCountdown((prev) => {
-          if (prev <= 1) {
-            fetchExchangeRate();
-            return 20;
-          }
-          return prev - 1;
-        });
-      }, 1000);
-
-      // Cleanup khi màn hình mất focus
-      return () => clearInterval(countdownInterval);
-    }, [])
+    React.useCallback(() => ExchangeRateService.acquire(), [])
   );
 
+  // Render last known profile/wallets/banks immediately; returns false on a cache miss
+  const applyCachedData = () => {
+    const profile = ResponseCache.peek('/client/profile');
+    const wallets = ResponseCache.peek('/client/wallet/data');
+    const banks = ResponseCache.peek('/client/bank/data');
+    if (!profile?.status || !wallets?.status || !banks?.status) return false;
+
+    setUserProfile(profile.data);
+    setHasTRC20Wallet((wallets.data || []).length > 0);
+    setHasBankAccount((banks.data || []).length > 0);
+    setIsLoadingProfile(false);
+    setIsLoadingWallets(false);
+    setIsLoadingBanks(false);
+    return true;
+  };
+
   // Initial data loading
   useEffect(() => {
     const loadInitialData = async () => {
       setIsInitialLoading(true);
+      await ResponseCache.hydrate();
+      if (applyCachedData()) {
+        // The focus refresh below revalidates in the background
+        hasContentRef.current = true;
+        markTimeToContent('Home', 'cache');
+        setIsInitialLoading(false);
+        return;
+      }
+
       try {
         await Promise.all([
           fetchUserProfile(),
           fetchTRC20Wallets(),
           fetchBankAccounts()
         ]);
+        hasContentRef.current = true;
+        markTimeToContent('Home', 'network');
       } finally {
         setIsInitialLoading(false);
       }
@@ -229,7 +245,9 @@ const HomeScreen: StackScreen<'Home'> = () => {
     React.useCallback(() => {
       if (!isInitialLoading) {
         const refreshData = async () => {
-          setIsRefreshing(true);
+          // Revalidate silently when content is already on screen
+          const showOverlay = !hasContentRef.current;
+          if (showOverlay) setIsRefreshing(true);
           try {
             // Always refresh wallet and bank data when focusing
             await Promise.all([
@@ -238,7 +256,7 @@ const HomeScreen: StackScreen<'Home'> = () => {
               fetchUserProfile()
             ]);
           } finally {
-            setIsRefreshing(false);
+            if (showOverlay) setIsRefreshing(false);
           }
         };
         
@@ -247,32 +265,6 @@ const HomeScreen: StackScreen<'Home'> = () => {
     }, [isInitialLoading])
   );
 
-  // Function to format amount with commas for display
-  const formatAmountForDisplay = (amount: string) => {
-    if (!amount || amount === '0') return '0';
-    
-    // Remove existing commas
-    const cleanAmount = amount.replace(/,/g, '');
-    
-    // Add commas for thousands separator based on input type
-    const isInputtingVND = (activeTab === 'buy' && !isSwapped) || (activeTab === 'sell' && isSwapped);
-    const isInputtingUSDT = (activeTab === 'sell' && !isSwapped) || (activeTab === 'buy' && isSwapped);
-    
-    if (isInputtingVND) {
-      // For VND, add commas every 3 digits from right
-      return cleanAmount.replace(/\B(?=(\d{3})+(?!\d))/g, ',');
-    } else if (isInputtingUSDT) {
-      // For USDT, keep decimal places but add commas for integer part
-      const parts = cleanAmount.split('.');
-      if (parts.length === 2) {
-        return parts[0].replace(/\B(?=(\d{3})+(?!\d))/g, ',') + '.' + parts[1];
-      }
-      return parts[0].replace(/\B(?=(\d{3})+(?!\d))/g, ',');
-    }
-    
-    return cleanAmount;
-  };
-
   // Function to calculate dynamic font size based on amount length
   const getAmountFontSize = (amount: string) => {
     if (!amount || amount === '0') return wp("20%");
@@ -291,102 +283,56 @@ const HomeScreen: StackScreen<'Home'> = () => {
     return wp("6%");
   };
 
-  const handleNumberPress = (num: string) => {
-    if (num === '.' && amount.includes('.')) return;
+  const alertLimit = (rule: EntryRule) => {
+    Alert.alert(
+      'Notification',
+      rule === VND_ENTRY
+        ? 'Maximum VND amount is 999,999,999,999'
+        : 'Maximum USDT amount is 999,999.99'
+    );
+  };
 
-    // Remove commas from current amount for processing
-    const cleanAmount = amount.replace(/,/g, '');
-    const newAmount = cleanAmount + num;
-    
-    // Kiểm tra định dạng số theo loại tiền tệ và chế độ swap
-    let isValidFormat = false;
-    const isInputtingVND = (activeTab === 'buy' && !isSwapped) || (activeTab === 'sell' && isSwapped);
-    const isInputtingUSDT = (activeTab === 'sell' && !isSwapped) || (activeTab === 'buy' && isSwapped);
-    
-    if (isInputtingVND) {
-      // VND: chỉ cho phép số nguyên
-      isValidFormat = /^\d+$/.test(newAmount);
-    } else if (isInputtingUSDT) {
-      // USDT: cho phép tối đa 2 chữ số thập phân
-      isValidFormat = /^\d*\.?\d{0,2}$/.test(newAmount);
-    }
-    
-    if (isValidFormat) {
-      const numValue = parseFloat(newAmount);
-      if (!isNaN(numValue)) {
-        // Check limit by transaction type
-        const maxAmount = activeTab === 'buy' ? MAX_VND_AMOUNT : MAX_USDT_AMOUNT;
-        if (numValue > maxAmount) {
-          Alert.alert(
-            'Notification',
-            activeTab === 'buy'
-              ? 'Maximum VND amount is 999,999,999,999'
-              : 'Maximum USDT amount is 999,999.99'
-          );
-          return;
-        }
-
-        // Always set the amount, let formatAmountForDisplay handle the formatting
-        setAmount(newAmount);
-      }
+  // Each key updates the entry in place: no reparse or regrouping of the whole string
+  const handleNumberPress = (num: string) => {
+    const next = pressKey(entry, num);
+    if (next === entry) return;
+    if (next.units > (next.rule === VND_ENTRY ? MAX_VND_AMOUNT : MAX_USDT_AMOUNT)) {
+      alertLimit(next.rule);
+      return;
     }
+    setEntry(next);
   };
 
   const handleDelete = () => {
-    // Remove commas before processing
-    const cleanAmount = amount.replace(/,/g, '');
-    const newAmount = cleanAmount.slice(0, -1);
-    setAmount(newAmount);
+    setEntry(deleteKey(entry));
   };
 
   const handleShortcutPress = (shortcut: string) => {
     let value = shortcut;
-    
+
     if (activeTab === 'buy') {
       // For VND (buy tab) - handle K, M shortcuts
       if (shortcut.endsWith('K')) {
-        value = (parseFloat(shortcut.replace('K', '')) * 1000).toString();
+        value = shortcut.replace('K', '000');
       } else if (shortcut.endsWith('M')) {
-        value = (parseFloat(shortcut.replace('M', '')) * 1000000).toString();
-      }
-    } else {
-      // For USDT (sell tab) - handle direct USDT amounts
-      // The shortcuts are already in USDT format (10, 50, 100, 500)
-      // Don't add .00 to allow further input
-      const numValue = parseFloat(shortcut);
-      if (!isNaN(numValue)) {
-        value = numValue.toString();
+        value = shortcut.replace('M', '000000');
       }
     }
+    // USDT shortcuts (10, 50, 100, 500) are entered as typed, so more digits can follow
 
-    const numValue = parseFloat(value);
-    if (!isNaN(numValue)) {
-      // Check limit by transaction type
-      const maxAmount = activeTab === 'buy' ? MAX_VND_AMOUNT : MAX_USDT_AMOUNT;
-      if (numValue > maxAmount) {
-        Alert.alert(
-          'Notification',
-          activeTab === 'buy'
-            ? 'Maximum VND amount is 999,999,999,999'
-            : 'Maximum USDT amount is 999,999.99'
-        );
-        return;
-      }
-
-      // Set amount without formatting - let formatAmountForDisplay handle it
-      if (activeTab === 'buy') {
-        // VND round to integer
-        setAmount(Math.round(numValue).toString());
-      } else {
-        // USDT keep as string to allow further input
-        setAmount(value);
-      }
+    const rule = entryRuleFor(activeTab, isSwapped);
+    const next = entryFromText(rule, value);
+    if (!next) return;
+    if (next.units > (rule === VND_ENTRY ? MAX_VND_AMOUNT : MAX_USDT_AMOUNT)) {
+      alertLimit(rule);
+      return;
     }
+    setEntry(next);
   };
 
   const handleSwap = () => {
     setIsSwapped(!isSwapped);
-    setAmount(''); // Clear amount when swapping
+    setEntry(emptyEntry(entryRuleFor(activeTab, !isSwapped))); // Clear amount when swapping
   };
 
   // Check verification status
@@ -427,9 +373,14 @@ const HomeScreen: StackScreen<'Home'> = () => {
     return activeTab === 'buy' ? t('home.buyUsdtButton') : t('home.sellUsdtButton');
   };
 
+  // Warm Payment's selectable list while the finger is still down
+  const prefetchPayment = () => {
+    if (!canPerformTransaction()) return;
+    QueryCache.prefetch(activeTab === 'buy' ? walletsQuery : bankAccountsQuery);
+  };
+
   const handleAction = () => {
-    const cleanAmount = amount.replace(/,/g, '');
-    if (!cleanAmount || parseFloat(cleanAmount) === 0) return;
+    if (entry.units <= 0) return;
 
     // Check verification status before allowing transaction
     if (!checkVerificationStatus()) {
@@ -492,22 +443,19 @@ const HomeScreen: StackScreen<'Home'> = () => {
       return;
     }
 
-    let finalAmount = cleanAmount;
+    let finalAmount = formatUnits(entry.units, entry.rule.scale, { minDigits: 0 });
     let finalType = activeTab;
 
-    // Xử lý logic swap
+    // Xử lý logic swap. Rounded up, so the amount sent covers what the user asked for
     if (isSwapped) {
       if (activeTab === 'buy') {
         // Buy tab + swap: nhập USDT muốn nhận → cần tính VND cần đổi
-        const usdtAmount = parseFloat(cleanAmount);
-        const vndAmount = (usdtAmount * binanceRate).toString();
-        finalAmount = vndAmount;
+        finalAmount = usdtToVnd(entry.units, rateUnits, 'up').toString();
         finalType = 'buy'; // Vẫn là buy nhưng amount là VND
       } else {
         // Sell tab + swap: nhập VND muốn nhận → cần tính USDT cần đổi
-        const vndAmount = parseFloat(cleanAmount);
-        const usdtAmount = (vndAmount / binanceRate).toFixed(2);
-        finalAmount = usdtAmount;
+        const usdtAmount = vndToUsdt(entry.units, rateUnits, 'up');
+        finalAmount = formatUnits(usdtAmount, USDT_SCALE, { digits: 2, mode: 'up' });
         finalType = 'sell'; // Vẫn là sell nhưng amount là USDT
       }
     }
@@ -535,7 +483,7 @@ const HomeScreen: StackScreen<'Home'> = () => {
           style={[styles.tab, activeTab === 'buy' && styles.activeTab]}
           onPress={() => {
             setActiveTab('buy');
-            setAmount('');
+            setEntry(emptyEntry(entryRuleFor('buy', isSwapped)));
           }}
         >
           <Text style={[styles.tabText, activeTab === 'buy' && styles.activeTabText]}>
@@ -546,7 +494,7 @@ const HomeScreen: StackScreen<'Home'> = () => {
           style={[styles.tab, activeTab === 'sell' && styles.activeTab]}
           onPress={() => {
             setActiveTab('sell');
-            setAmount('');
+            setEntry(emptyEntry(entryRuleFor('sell', isSwapped)));
           }}
         >
           <Text style={[styles.tabText, activeTab === 'sell' && styles.activeTabText]}>
@@ -570,8 +518,8 @@ const HomeScreen: StackScreen<'Home'> = () => {
           {/* Amount Display */}
           <View style={styles.topSection}>
             <View style={styles.amountContainer}>
-              <Text style={[styles.amountZero, { fontSize: getAmountFontSize(amount) }]}>
-                {formatAmountForDisplay(amount)}
+              <Text style={[styles.amountZero, { fontSize: getAmountFontSize(entry.raw) }]}>
+                {entry.display}
               </Text>
               <Text style={styles.amountLabel}>
                 {isSwapped 
@@ -585,16 +533,10 @@ const HomeScreen: StackScreen<'Home'> = () => {
             <View style={styles.exchangeContainer}>
               <View style={styles.exchangeRow}>
                 <Text style={styles.exchangeAmount}>
-                  ≈ {amount ? (
-                    isSwapped 
-                      ? (activeTab === 'buy' 
-                          ? `${(parseFloat(amount.replace(/,/g, '')) * binanceRate).toLocaleString('vi-VN')} VND`
-                          : `${(parseFloat(amount.replace(/,/g, '')) / binanceRate).toFixed(2)} USDT`
-                        )
-                      : (activeTab === 'buy' 
-                          ? `${(parseFloat(amount.replace(/,/g, '')) / binanceRate).toFixed(2)} USDT`
-                          : `${(parseFloat(amount.replace(/,/g, '')) * binanceRate).toLocaleString('vi-VN')} VND`
-                        )
+                  ≈ {entry.raw ? (
+                    entry.rule === VND_ENTRY
+                      ? `${formatUnits(vndToUsdt(entry.units, rateUnits, 'down'), USDT_SCALE, { digits: 2, mode: 'down' })} USDT`
+                      : `${formatVND(Number(usdtToVnd(entry.units, rateUnits, 'down')))} VND`
                   ) : (
                     isSwapped 
                       ? (activeTab === 'buy' ? '0 VND' : '0 USDT')
@@ -607,12 +549,13 @@ const HomeScreen: StackScreen<'Home'> = () => {
               </View>
               <View style={styles.rateContainer}>
                 <Text style={styles.exchangeRate}>
-                  1 USDT = {binanceRate.toLocaleString('vi-VN')} VND
+                  1 USDT = {formatVND(binanceRate)} VND
                 </Text>
                 <View style={styles.countdownContainer}>
-                  <Text style={styles.countdownText}>
-                    Update after: {countdown}s
-                  </Text>
+                  <RateCountdown
+                    style={styles.countdownText}
+                    format={(seconds) => `Update after: ${seconds}s`}
+                  />
                   {isLoadingRate && (
                     <Icon name="loading" size={16} color="#666" />
                   )}
@@ -687,10 +630,11 @@ const HomeScreen: StackScreen<'Home'> = () => {
           <TouchableOpacity 
             style={[
               styles.confirmButton,
-              (!amount || parseFloat(amount.replace(/,/g, '')) === 0 || !canPerformTransaction()) && styles.confirmButtonDisabled
+              (entry.units <= 0 || !canPerformTransaction()) && styles.confirmButtonDisabled
             ]}
+            onPressIn={prefetchPayment}
             onPress={handleAction}
-            disabled={!amount || parseFloat(amount.replace(/,/g, '')) === 0 || !canPerformTransaction()}
+            disabled={entry.units <= 0 || !canPerformTransaction()}
           >
             <Text style={styles.confirmButtonText}>
               {getButtonText()}
@@ -8,8 +8,11 @@ import {
 import AsyncStorage from '@react-native-async-storage/async-storage';
 import { useAuth } from '../contexts/AuthContext';
 import { theme } from '../theme/colors';
-import { getToken } from '../utils/TokenManager';
+import { getToken, removeToken } from '../utils/TokenManager';
 import api from '../utils/Api';
+import { resetTo } from '../navigation/NavigationService';
+import { ResponseCache } from '../utils/responseCache';
+import { markTimeToContent } from '../utils/startupMetrics';
 
 interface LoadingScreenProps {
   navigation: any;
@@ -22,6 +25,8 @@ const LoadingScreen: React.FC<LoadingScreenProps> = ({ navigation }) => {
     try {
     const res = await api.get('/auth/check-login');
     if (res.data?.status) {
+      ResponseCache.put('/auth/check-login', res.data);
+      markTimeToContent('Loading', 'network');
       navigation.replace('MainTabs');
       } else {
         navigation.replace('Login');
@@ -33,13 +38,40 @@ const LoadingScreen: React.FC<LoadingScreenProps> = ({ navigation }) => {
   
   }
 
+  // Last session was valid: open the app now, confirm with the server in the background
+  const revalidateLogin = async () => {
+    try {
+      const res = await api.get('/auth/check-login');
+      if (res.data?.status) {
+        ResponseCache.put('/auth/check-login', res.data);
+      } else {
+        await removeToken();
+        resetTo('Login');
+      }
+    } catch (error) {
+      // 401/timeout are handled by the Api interceptor
+      console.log('Background check-login error:', error);
+    }
+  };
+
   useEffect(() => {
     const checkFirstLaunch = async () => {
       try {
+        const [isFirstLaunch, token] = await Promise.all([
+          AsyncStorage.getItem('isFirstLaunch'),
+          getToken(),
+          ResponseCache.hydrate(),
+        ]);
+        if (isFirstLaunch !== null && token && ResponseCache.peek('/auth/check-login')?.status) {
+          markTimeToContent('Loading', 'cache');
+          navigation.replace('MainTabs');
+          revalidateLogin();
+          return;
+        }
+
         // Đợi loading animation 1.5s
         await new Promise((resolve: any) => setTimeout(resolve, 1500));
 
-        const isFirstLaunch = await AsyncStorage.getItem('isFirstLaunch');
         if (isFirstLaunch === null) {
           // Lần đầu mở app -> Onboarding
           navigation.replace('Onboarding');
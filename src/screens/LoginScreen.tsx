@@ -36,7 +36,7 @@ const { width, height } = Dimensions.get('window');
 
 const LoginScreen: React.FC<LoginScreenProps> = ({ navigation }) => {
   const { signIn } = useAuth();
-  const { t, getCurrentLanguage } = useTranslation();
+  const { t, getCurrentLanguage } = useTranslation('auth');
   const [identifier, setIdentifier] = useState('');
   const [password, setPassword] = useState('');
   const [loading, setLoading] = useState(false);
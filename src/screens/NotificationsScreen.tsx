@@ -1,4 +1,4 @@
-import React from 'react';
+import React, { useCallback, useMemo } from 'react';
 import {
   View,
   Text,
@@ -12,51 +12,110 @@ import Icon from 'react-native-vector-icons/MaterialCommunityIcons';
 import { useNavigation } from '@react-navigation/native';
 import { theme } from '../theme/colors';
 import { useTranslation } from '../hooks/useTranslation';
+import { formatTime as formatClock } from '../utils/format';
+import {
+  UINotification,
+  selectUnreadTotal,
+  useNotificationList,
+  useNotificationStore,
+} from '../socket/notificationStore';
+
+const DAY_MS = 24 * 60 * 60 * 1000;
+
+const getNotificationIcon = (category?: string) => {
+  switch (category) {
+    case 'transaction':
+      return { name: 'swap-horizontal', color: '#4A90E2' };
+    case 'security':
+      return { name: 'shield-alert', color: '#FF3B30' };
+    case 'system':
+      return { name: 'cog', color: '#FF9500' };
+    default:
+      return { name: 'bell', color: '#8E8E93' };
+  }
+};
 
-const getNotifications = (t: any) => [
-  {
-    id: '1',
-    type: 'transaction',
-    title: t('notifications.transactionSuccessful'),
-    message: t('notifications.transactionMessage'),
-    time: `2 ${t('notifications.hoursAgo')}`,
-    read: false,
-  },
-  {
-    id: '2',
-    type: 'security',
-    title: t('notifications.newLogin'),
-    message: t('notifications.loginMessage'),
-    time: `1 ${t('notifications.daysAgo')}`,
-    read: true,
-  },
-  {
-    id: '3',
-    type: 'system',
-    title: t('notifications.systemMaintenance'),
-    message: t('notifications.maintenanceMessage'),
-    time: `2 ${t('notifications.daysAgo')}`,
-    read: true,
-  },
-];
+// Memoized row: marking one entry read only re-renders that row
+const NotificationRow = React.memo(({
+  notification,
+  time,
+  onPress,
+}: {
+  notification: UINotification;
+  time: string;
+  onPress: (id: string) => void;
+}) => {
+  const icon = getNotificationIcon(notification.category);
+  return (
+    <TouchableOpacity
+      style={[
+        styles.notificationItem,
+        !notification.read && styles.unreadItem,
+      ]}
+      onPress={() => onPress(notification.id)}
+    >
+      <View style={[
+        styles.notificationIcon,
+        { backgroundColor: icon.color + '15' }
+      ]}>
+        <Icon
+          name={icon.name}
+          size={24}
+          color={icon.color}
+        />
+      </View>
+      <View style={styles.notificationContent}>
+        {!!notification.title && <Text style={styles.notificationTitle}>{notification.title}</Text>}
+        <Text style={styles.notificationMessage}>{notification.message}</Text>
+        <Text style={styles.notificationTime}>{time}</Text>
+      </View>
+      {!notification.read && <View style={styles.unreadDot} />}
+    </TouchableOpacity>
+  );
+});
 
 const NotificationsScreen = () => {
   const navigation = useNavigation();
-  const { t } = useTranslation();
-  const notifications = getNotifications(t);
+  const { t } = useTranslation('home');
+  // Newest first; only changes to the buffer re-render the screen
+  const notifications = useNotificationList();
+  const unreadTotal = useNotificationStore(selectUnreadTotal);
+  const markRead = useNotificationStore((s) => s.markRead);
+  const markAllRead = useNotificationStore((s) => s.markAllRead);
+
+  const { today, earlier } = useMemo(() => {
+    const startOfDay = new Date().setHours(0, 0, 0, 0);
+    const split = { today: [] as UINotification[], earlier: [] as UINotification[] };
+    for (const n of notifications) {
+      ((n.at ?? 0) >= startOfDay ? split.today : split.earlier).push(n);
+    }
+    return split;
+  }, [notifications]);
 
-  const getNotificationIcon = (type: string) => {
-    switch (type) {
-      case 'transaction':
-        return { name: 'swap-horizontal', color: '#4A90E2' };
-      case 'security':
-        return { name: 'shield-alert', color: '#FF3B30' };
-      case 'system':
-        return { name: 'cog', color: '#FF9500' };
-      default:
-        return { name: 'bell', color: '#8E8E93' };
+  const formatTime = useCallback((at?: number) => {
+    if (!at) return '';
+    const diff = Date.now() - at;
+    if (diff < DAY_MS) {
+      return formatClock(at);
     }
-  };
+    return `${Math.floor(diff / DAY_MS)} ${t('notifications.daysAgo')}`;
+  }, [t]);
+
+  const renderSection = (title: string, list: UINotification[]) => (
+    <View style={styles.section}>
+      <Text style={styles.sectionTitle}>{title}</Text>
+      <View style={styles.notificationList}>
+        {list.map(notification => (
+          <NotificationRow
+            key={notification.id}
+            notification={notification}
+            time={formatTime(notification.at)}
+            onPress={markRead}
+          />
+        ))}
+      </View>
+    </View>
+  );
 
   return (
     <SafeAreaView style={styles.container}>
@@ -68,77 +127,20 @@ const NotificationsScreen = () => {
           <Icon name="arrow-left" size={24} color="#1C1C1E" />
         </TouchableOpacity>
         <Text style={styles.headerTitle}>{t('notifications.title')}</Text>
-        <TouchableOpacity style={styles.headerRight}>
-          <Icon name="dots-horizontal" size={24} color="#1C1C1E" />
+        <TouchableOpacity style={styles.headerRight} onPress={markAllRead} disabled={unreadTotal === 0}>
+          <Icon name="check-all" size={24} color={unreadTotal > 0 ? '#1C1C1E' : '#C7C7CC'} />
         </TouchableOpacity>
       </View>
 
       <ScrollView style={styles.content}>
+        {notifications.length === 0 && (
+          <Text style={styles.emptyText}>{t('notifications.empty')}</Text>
+        )}
         {/* Today Section */}
-        <View style={styles.section}>
-          <Text style={styles.sectionTitle}>{t('notifications.today')}</Text>
-          <View style={styles.notificationList}>
-            {notifications.filter(n => n.time.includes(t('notifications.hoursAgo'))).map(notification => (
-              <TouchableOpacity
-                key={notification.id}
-                style={[
-                  styles.notificationItem,
-                  !notification.read && styles.unreadItem,
-                ]}
-              >
-                <View style={[
-                  styles.notificationIcon,
-                  { backgroundColor: getNotificationIcon(notification.type).color + '15' }
-                ]}>
-                  <Icon
-                    name={getNotificationIcon(notification.type).name}
-                    size={24}
-                    color={getNotificationIcon(notification.type).color}
-                  />
-                </View>
-                <View style={styles.notificationContent}>
-                  <Text style={styles.notificationTitle}>{notification.title}</Text>
-                  <Text style={styles.notificationMessage}>{notification.message}</Text>
-                  <Text style={styles.notificationTime}>{notification.time}</Text>
-                </View>
-                {!notification.read && <View style={styles.unreadDot} />}
-              </TouchableOpacity>
-            ))}
-          </View>
-        </View>
+        {today.length > 0 && renderSection(t('notifications.today'), today)}
 
         {/* Earlier Section */}
-        <View style={styles.section}>
-          <Text style={styles.sectionTitle}>{t('notifications.earlier')}</Text>
-          <View style={styles.notificationList}>
-            {notifications.filter(n => n.time.includes(t('notifications.daysAgo'))).map(notification => (
-              <TouchableOpacity
-                key={notification.id}
-                style={[
-                  styles.notificationItem,
-                  !notification.read && styles.unreadItem,
-                ]}
-              >
-                <View style={[
-                  styles.notificationIcon,
-                  { backgroundColor: getNotificationIcon(notification.type).color + '15' }
-                ]}>
-                  <Icon
-                    name={getNotificationIcon(notification.type).name}
-                    size={24}
-                    color={getNotificationIcon(notification.type).color}
-                  />
-                </View>
-                <View style={styles.notificationContent}>
-                  <Text style={styles.notificationTitle}>{notification.title}</Text>
-                  <Text style={styles.notificationMessage}>{notification.message}</Text>
-                  <Text style={styles.notificationTime}>{notification.time}</Text>
-                </View>
-                {!notification.read && <View style={styles.unreadDot} />}
-              </TouchableOpacity>
-            ))}
-          </View>
-        </View>
+        {earlier.length > 0 && renderSection(t('notifications.earlier'), earlier)}
       </ScrollView>
     </SafeAreaView>
   );
@@ -245,6 +247,11 @@ const styles = StyleSheet.create({
     backgroundColor: '#4A90E2',
     marginLeft: 8,
   },
+  emptyText: {
+    textAlign: 'center',
+    color: '#8E8E93',
+    marginTop: 32,
+  },
 });
 
 export default NotificationsScreen;
\ No newline at end of file
@@ -28,7 +28,7 @@ const { width, height } = Dimensions.get('window');
 const OTP_LENGTH = 6;
 
 const OTPVerificationScreen: StackScreen<'OTPVerification'> = ({ navigation, route }) => {
-  const { t } = useTranslation();
+  const { t } = useTranslation('auth');
   const { identifier, type, flow = 'forgot' } = route.params;
 
   const [otp, setOtp] = useState(['', '', '', '', '', '']);
@@ -44,7 +44,7 @@ interface OnboardingScreenProps {
 }
 
 const OnboardingScreen: React.FC<OnboardingScreenProps> = ({ navigation }) => {
-  const { t } = useTranslation();
+  const { t } = useTranslation('auth');
   const [activeIndex, setActiveIndex] = useState(0);
   const onboardingData = getOnboardingData(t);
 
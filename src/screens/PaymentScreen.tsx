@@ -18,7 +18,25 @@ import {
   heightPercentageToDP as hp,
 } from 'react-native-responsive-screen';
 import QRCode from '../component/QRCode';
-import api from '../utils/Api';
+import api, { batcher } from '../utils/Api';
+import { generateIdempotencyKey } from '../utils/retryPolicy';
+import { isQuoteRejection } from '../utils/rateQuote';
+import { QueryCache } from '../utils/queryCache';
+import { formatVND } from '../utils/format';
+import {
+  RATE_SCALE,
+  USDT_SCALE,
+  VND_SCALE,
+  formatUnits,
+  fromNumber,
+  parseDecimal,
+  quoteBuy,
+  quoteSell,
+  toApiNumber,
+} from '../utils/money';
+import { ExchangeRateService, useExchangeRateStore } from '../services/ExchangeRateService';
+import RateCountdown from '../component/RateCountdown';
+import { bankAccountsQuery, walletsQuery } from '../utils/queries';
 import SelectCustom from '../component/SelectCustom';
 import { getUser } from '../utils/TokenManager';
 import { useTranslation } from '../hooks/useTranslation';
@@ -69,17 +87,23 @@ const PaymentScreen = () => {
   const navigation = useNavigation();
   const route = useRoute();
   const paymentInfo = (route.params as any)?.paymentInfo as PaymentInfo;
-  const { t } = useTranslation();
+  const { t } = useTranslation('payment');
   const [selectedBank, setSelectedBank] = useState('');
   const [selectedBankId, setSelectedBankId] = useState<string>('');
   const [selectedReceiveTRC20, setSelectedReceiveTRC20] = useState('');
   const [selectedWalletId, setSelectedWalletId] = useState<string>('');
-  const [currentRate, setCurrentRate] = useState<number>(paymentInfo.rate || FALLBACK_RATE);
-  const [secondsLeft, setSecondsLeft] = useState<number>(20);
-  const [isLoadingRate, setIsLoadingRate] = useState(false);
-  const [feePercent, setFeePercent] = useState<number>(TRANSACTION_FEE_PERCENTAGE);
-  const isFetchingRef = useRef<boolean>(false);
+  // Same feed as Home, so the rate quoted there is the one shown here
+  const currentRate = useExchangeRateStore((s) => s.rate) || paymentInfo.rate || FALLBACK_RATE;
+  const isLoadingRate = useExchangeRateStore((s) => s.isLoading);
+  const feePercent = useExchangeRateStore((s) => s.fee) ?? TRANSACTION_FEE_PERCENTAGE;
+  // Exact units for the quote: VND whole dong, USDT 6 decimals, rate and fee 6 decimals
+  const rateUnits = fromNumber(currentRate, RATE_SCALE) ?? BigInt(0);
+  const feeUnits = fromNumber(feePercent, RATE_SCALE) ?? BigInt(0);
+  const amountUnits =
+    parseDecimal(String(paymentInfo.amount), paymentInfo.type === 'buy' ? VND_SCALE : USDT_SCALE, 'down') ?? BigInt(0);
   const transactionIdRef = useRef<string>(`MIMO${Date.now().toString().slice(-6)}`);
+  // One key per order: retries and double taps replay the same key, the server dedupes
+  const orderKeyRef = useRef<string>(generateIdempotencyKey());
   const [wallets, setWallets] = useState<Wallet[]>([]);
   const [bankAccounts, setBankAccounts] = useState<BankAccount[]>([]);
   const [banks, setBanks] = useState<{ [key: number]: { name: string; code: string; logo: string; } }>({});
@@ -94,23 +118,13 @@ const PaymentScreen = () => {
   const initializeData = async () => {
     setIsInitialLoading(true);
     try {
-      // Fetch user data
-      await fetchUser();
-      
-      // Fetch exchange rate
-      await fetchExchangeRate();
-      
-      // Fetch wallets for buy USDT
-      if (paymentInfo.type === 'buy') {
-        await fetchWallets();
-      }
-      
-      // Fetch banks and bank accounts for sell USDT
-      if (paymentInfo.type === 'sell') {
-        await fetchBanks();
-        await fetchBankAccounts();
-      }
-      
+      // Fire everything in the same tick so the GETs share one batch request
+      await Promise.all([
+        fetchUser(),
+        // Wallets for buy USDT, banks and bank accounts for sell USDT
+        ...(paymentInfo.type === 'buy' ? [fetchWallets()] : []),
+        ...(paymentInfo.type === 'sell' ? [fetchBanks(), fetchBankAccounts()] : []),
+      ]);
     } catch (error) {
       console.log('Error initializing data:', error);
     } finally {
@@ -125,11 +139,12 @@ const PaymentScreen = () => {
   // Refresh selectable data when screen gains focus (wallets/banks)
   useFocusEffect(
     React.useCallback(() => {
+      // maxAge 0: joins the mount request (or a prefetch still in flight) but never reuses stale data
       if (paymentInfo.type === 'buy') {
-        fetchWallets();
+        fetchWallets(0);
       } else if (paymentInfo.type === 'sell') {
         fetchBanks();
-        fetchBankAccounts();
+        fetchBankAccounts(0);
       }
       return () => {};
     }, [paymentInfo.type])
@@ -160,12 +175,12 @@ const PaymentScreen = () => {
   }, []);
 
   // Fetch TRC20 wallets to allow inline selection
-  const fetchWallets = async () => {
+  const fetchWallets = async (maxAge?: number) => {
     try {
-      const res = await api.get('/client/wallet/data');
-      console.log('Wallet data response:', res.data);
-      if (res?.data?.status) {
-        const list: Wallet[] = (res.data.data || []).map((w: any) => ({
+      const data = await QueryCache.fetch(walletsQuery, maxAge);
+      console.log('Wallet data response:', data);
+      if (data?.status) {
+        const list: Wallet[] = (data.data || []).map((w: any) => ({
           id: w.id,
           name: w.name,
           address: w.address_wallet,
@@ -189,7 +204,7 @@ const PaymentScreen = () => {
   // Fetch banks data to get bank names and logos
   const fetchBanks = async () => {
     try {
-      const response = await api.get('/client/bank/data-all');
+      const response = await batcher.get('/client/bank/data-all');
       if (response.data.status) {
         const bankData = response.data.data;
         const bankMap: { [key: number]: { name: string; code: string; logo: string; } } = {};
@@ -204,12 +219,12 @@ const PaymentScreen = () => {
   };
 
   // Fetch bank accounts for sell USDT
-  const fetchBankAccounts = async () => {
+  const fetchBankAccounts = async (maxAge?: number) => {
     try {
-      const res = await api.get('/client/bank/data');
-      console.log('Bank accounts response:', res.data);
-      if (res?.data?.status) {
-        const list: BankAccount[] = (res.data.data || []).map((b: any) => {
+      const data = await QueryCache.fetch(bankAccountsQuery, maxAge);
+      console.log('Bank accounts response:', data);
+      if (data?.status) {
+        const list: BankAccount[] = (data.data || []).map((b: any) => {
           const bankMeta = banks[b.id_bank];
           return {
             id: b.id,
@@ -236,54 +251,39 @@ const PaymentScreen = () => {
     }
   };
 
-  // Function to fetch rate/fee from backend API
-  const fetchExchangeRate = async () => {
-    if (isFetchingRef.current) return;
-    isFetchingRef.current = true;
-    setIsLoadingRate(true);
+  // Rate/fee come from the shared feed while this screen is focused
+  useFocusEffect(
+    React.useCallback(() => ExchangeRateService.acquire(), [])
+  );
 
-    try {
-      const res = await api.get('/client/exchange/rate');
-      const data: any = res.data || {};
-      const rate = data.rate ?? data.usdt_vnd_rate ?? data.exchange_rate;
-      if (rate && !isNaN(parseFloat(String(rate)))) {
-        setCurrentRate(parseFloat(String(rate)));
-      } else {
-        throw new Error('Invalid rate format');
-      }
-      const feeValue = parseFloat(String(data.fee));
-      if (!isNaN(feeValue)) {
-        setFeePercent(feeValue);
-      }
-    } catch (error) {
-      console.log('API failed, using fallback rate:', error);
-      setCurrentRate(FALLBACK_RATE);
-    } finally {
-      isFetchingRef.current = false;
-      setIsLoadingRate(false);
+  // Orders go out on a live server quote; if it had to be renewed at a different
+  // rate, the user sees the new numbers and confirms again
+  const lockQuote = async () => {
+    const quote = await ExchangeRateService.ensureQuote();
+    if (quote.rate && quote.rate !== currentRate) {
+      Alert.alert(t('payment.notification'), t('payment.quoteExpired'));
+      return null;
     }
+    return {
+      rate: fromNumber(quote.rate || currentRate, RATE_SCALE) ?? rateUnits,
+      quoteFields: quote.quoteId ? { quote_id: quote.quoteId } : {},
+    };
   };
 
-  // 60s countdown and auto-refresh (only after initial loading)
-  useEffect(() => {
-    if (!isInitialLoading) {
-      setSecondsLeft(60);
-      const timer = setInterval(() => {
-        setSecondsLeft((prev) => {
-          if (prev <= 1) {
-            // time to refresh
-            fetchExchangeRate();
-            return 60;
-          }
-          return prev - 1;
-        });
-      }, 1000);
-      return () => clearInterval(timer);
+  const handleOrderError = (err: any) => {
+    // Rejected by the server (4xx), so no order exists: next attempt is a new order
+    if (err?.response && err.response.status < 500) {
+      orderKeyRef.current = generateIdempotencyKey();
     }
-  }, [isInitialLoading]);
-
+    if (isQuoteRejection(err)) {
+      ExchangeRateService.invalidateQuote();
+      Alert.alert(t('payment.notification'), t('payment.quoteExpired'));
+      return;
+    }
+    Alert.alert(t('payment.error'), err?.response?.data?.message || t('payment.createTransactionFailed'));
+  };
 
-  const handleConfirm = () => {
+  const handleConfirm = async () => {
     if (paymentInfo.type === 'buy') {
       const walletId = selectedWalletId
         ? parseInt(selectedWalletId, 10)
@@ -293,14 +293,16 @@ const PaymentScreen = () => {
         return;
       }
 
-      const amountNum = parseFloat(String(paymentInfo.amount));
-      const usdtAmount = amountNum / currentRate;
+      const locked = await lockQuote();
+      if (!locked) return;
+      const { usdt } = quoteBuy(amountUnits, locked.rate, feeUnits);
 
       api.post('/client/create-transactions/vnd-usdt', {
         email: user?.email ?? '',
-        amount_usdt: usdtAmount,
+        amount_usdt: toApiNumber(usdt, USDT_SCALE),
         wallet_usdt_id: walletId,
-      })
+        ...locked.quoteFields,
+      }, { idempotencyKey: orderKeyRef.current })
         .then((res) => {
           if (res?.data?.status) {
             console.log('res', res.data);
@@ -316,7 +318,7 @@ const PaymentScreen = () => {
         })
         .catch((err) => {
           console.log('Create buy tx error:', err);
-          Alert.alert(t('payment.error'), err?.response?.data?.message || t('payment.createTransactionFailed'));
+          handleOrderError(err);
         });
     } else {
       // Determine bank account ID: selected one or default
@@ -328,12 +330,15 @@ const PaymentScreen = () => {
         return;
       }
 
-      const amountNum = parseFloat(String(paymentInfo.amount));
+      const locked = await lockQuote();
+      if (!locked) return;
+
       api.post('/client/create-transactions/usdt-vnd', {
         email: user?.email ?? '',
-        amount_usdt: amountNum,
+        amount_usdt: toApiNumber(amountUnits, USDT_SCALE),
         detail_bank_id: bankAccountId,
-      })
+        ...locked.quoteFields,
+      }, { idempotencyKey: orderKeyRef.current })
         .then((res) => {
           if (res?.data?.status) {
             console.log('Sell USDT response:', res.data);
@@ -350,7 +355,7 @@ const PaymentScreen = () => {
         })
         .catch((err) => {
           console.log('Create sell tx error:', err);
-          Alert.alert(t('payment.error'), err?.response?.data?.message || t('payment.createTransactionFailed'));
+          handleOrderError(err);
         });
     }
   };
@@ -361,41 +366,43 @@ const PaymentScreen = () => {
   };
 
   const getTransactionInfo = () => {
-    const amountNum = parseFloat(paymentInfo.amount);
     if (paymentInfo.type === 'buy') {
-      const usdtAmount = (amountNum / currentRate).toFixed(2);
-      const feeAmount = amountNum * (feePercent / 100);
-      const totalVND = amountNum + feeAmount;
+      const quote = quoteBuy(amountUnits, rateUnits, feeUnits);
+      // Shown at 2 decimals, rounded down like the amount that is sent
+      const usdtAmount = formatUnits(quote.usdt, USDT_SCALE, { digits: 2, mode: 'down' });
+      const feeAmount = Number(quote.fee);
+      const totalVND = Number(quote.total);
       const transactionId = transactionIdRef.current;
 
       return {
         usdtWant: `${usdtAmount} USDT`,
-        exchangeRate: `1 USDT = ${currentRate.toLocaleString('vi-VN')} VND`,
-        fee: `${feeAmount.toLocaleString('vi-VN')} VND (${feePercent}%)`,
-        totalVND: `${totalVND.toLocaleString('vi-VN')} VND`,
+        exchangeRate: `1 USDT = ${formatVND(currentRate)} VND`,
+        fee: `${formatVND(feeAmount)} VND (${feePercent}%)`,
+        totalVND: `${formatVND(totalVND)} VND`,
         transactionId,
         transferInfo: {
           bankName: 'BIDV',
           accountNumber: '963336984884401',
           accountName: 'BAOKIM CONG TY CO PHAN THUONG MAI DIEN TU BAO KIM',
           transferContent: 'Lien ket vi Baokim',
-          amount: totalVND.toLocaleString('vi-VN'),
+          amount: formatVND(totalVND),
         }
       };
     } else {
       // Sell USDT: sử dụng phí từ biến cố định
-      const feeAmount = amountNum * currentRate * (feePercent / 100);
-      const receiveAmount = (amountNum * currentRate) - feeAmount;
+      const quote = quoteSell(amountUnits, rateUnits, feeUnits);
+      const feeAmount = Number(quote.fee);
+      const receiveAmount = Number(quote.receive);
 
       return {
         usdtSell: `${paymentInfo.amount} USDT`,
-        exchangeRate: `1 USDT = ${currentRate.toLocaleString('vi-VN')} VND`,
-        fee: `${feeAmount.toLocaleString('vi-VN')} VND (${feePercent}%)`,
-        receiveVND: `${receiveAmount.toLocaleString('vi-VN')} VND`,
+        exchangeRate: `1 USDT = ${formatVND(currentRate)} VND`,
+        fee: `${formatVND(feeAmount)} VND (${feePercent}%)`,
+        receiveVND: `${formatVND(receiveAmount)} VND`,
         sendAmount: `${paymentInfo.amount} USDT`,
-        receiveAmount: `${receiveAmount.toLocaleString('vi-VN')} VND`,
-        feeDisplay: `${feeAmount.toLocaleString('vi-VN')} VND`,
-        total: `${receiveAmount.toLocaleString('vi-VN')} VND`,
+        receiveAmount: `${formatVND(receiveAmount)} VND`,
+        feeDisplay: `${formatVND(feeAmount)} VND`,
+        total: `${formatVND(receiveAmount)} VND`,
       };
     }
   };
@@ -441,10 +448,10 @@ const PaymentScreen = () => {
         <Text style={styles.headerTitle}>
           {paymentInfo.type === 'buy' ? t('payment.buyUsdt') : t('payment.sellUsdt')}
         </Text>
-        <TouchableOpacity style={styles.headerRight} onPress={fetchExchangeRate}>
+        <TouchableOpacity style={styles.headerRight} onPress={() => ExchangeRateService.refresh()}>
           <Icon name="refresh" size={16} color="#4A90E2" />
           <Text style={styles.headerRightText}>
-            {secondsLeft}s • {currentRate.toLocaleString('vi-VN')}
+            <RateCountdown /> • {formatVND(currentRate)}
           </Text>
           {isLoadingRate && (
             <Icon name="loading" size={14} color="#4A90E2" style={{ marginLeft: 4 }} />
@@ -26,7 +26,7 @@ const { width, height } = Dimensions.get('window');
 
 const PhoneVerificationScreen = () => {
   const navigation = useNavigation();
-  const { t } = useTranslation();
+  const { t } = useTranslation('auth');
   const [phone, setPhone] = useState('');
   const [code, setCode] = useState('');
   const [isCodeSent, setIsCodeSent] = useState(false);
@@ -91,7 +91,7 @@ interface UserProfile {
 }
 
 const ProfileScreen: StackScreen<'Profile'> = () => {
-  const { t } = useTranslation();
+  const { t } = useTranslation('account');
   const navigation = useNavigation();
   const menuItems = getMenuItems(t);
   const [user, setUser] = useState<UserProfile | null>(null);
@@ -286,10 +286,17 @@ const ProfileScreen: StackScreen<'Profile'> = () => {
         {/* Profile Header */}
         <View style={styles.header}>
           <View style={styles.avatarContainer}>
-            <Image
-              source={require('../assets/images/avatar.jpeg')}
-              style={styles.avatar}
-            />
+            {/* Dev builds: long-press the avatar to open the API metrics screen */}
+            <TouchableOpacity
+              activeOpacity={1}
+              delayLongPress={1500}
+              onLongPress={__DEV__ ? () => (navigation as any).navigate('ApiMetrics') : undefined}
+            >
+              <Image
+                source={require('../assets/images/avatar.jpeg')}
+                style={styles.avatar}
+              />
+            </TouchableOpacity>
             <TouchableOpacity 
               style={styles.editButton}
               activeOpacity={0.7}
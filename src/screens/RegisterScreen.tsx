@@ -31,7 +31,7 @@ const { width, height } = Dimensions.get('window');
 
 
 const RegisterScreen: React.FC<RegisterScreenProps> = ({ navigation }) => {
-  const { t } = useTranslation();
+  const { t } = useTranslation('auth');
 
   const [formData, setFormData] = useState({
     name: '',
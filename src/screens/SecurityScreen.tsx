@@ -43,7 +43,7 @@ const SecurityScreen = () => {
   const [refreshing, setRefreshing] = useState(false);
   const [isEkycLoading, setIsEkycLoading] = useState(false);
   const [ekycLoadingMessage, setEkycLoadingMessage] = useState('');
-  const { t  , currentLanguage} = useTranslation();
+  const { t  , currentLanguage} = useTranslation('account');
 
 
   // Fetch user profile
@@ -20,7 +20,9 @@ import {
   heightPercentageToDP as hp,
 } from 'react-native-responsive-screen';
 import { getUser } from '../utils/TokenManager';
-import api from '../utils/Api';
+import { QueryCache } from '../utils/queryCache';
+import { formatDate, formatTime, formatVND } from '../utils/format';
+import { successTransactionQuery } from '../utils/queries';
 import { useTranslation } from '../hooks/useTranslation';
 
 type SuccessTransactionDetail = {
@@ -49,7 +51,7 @@ type SuccessTransactionDetail = {
 };
 
 const SuccessTransactionDetailScreen = () => {
-  const { t } = useTranslation();
+  const { t } = useTranslation('payment');
   const navigation = useNavigation();
   const route = useRoute();
   const params: any = route.params || {};
@@ -96,20 +98,14 @@ const SuccessTransactionDetailScreen = () => {
 
   React.useEffect(() => {
     const fetchSuccessTransaction = async () => {
-      if (!idTransaction || transaction || !user?.email) return;
+      if (!idTransaction || transaction) return;
       setLoading(true);
       try {
-        const endpoint = typeParam === 'sell' 
-          ? '/client/transaction-success/usdt-vnd' 
-          : '/client/transaction-success/vnd-usdt';
-        
-        const res = await api.post(endpoint, {
-          email: user.email,
-          id_transaction: idTransaction,
-        });
-        if (res?.data?.status) {
-          console.log('Success transaction res', res.data);
-          const d = res.data.data || {};
+        // Endpoint is picked from the transaction type; joins a prefetch if one is in flight
+        const resData = await QueryCache.fetch(successTransactionQuery(typeParam, idTransaction));
+        if (resData?.status) {
+          console.log('Success transaction res', resData);
+          const d = resData.data || {};
           convertTransaction(d);
         }
       } catch (err : any) {
@@ -119,7 +115,22 @@ const SuccessTransactionDetailScreen = () => {
       }
     };
     fetchSuccessTransaction();
-  }, [idTransaction, transaction, typeParam, user?.email]);
+  }, [idTransaction, transaction, typeParam]);
+
+  // Opened from a history row: show it right away, then refresh from the detail
+  // endpoint (usually the prefetch started on press-in)
+  React.useEffect(() => {
+    if (!idTransaction || !transactionParam) return;
+    let active = true;
+    QueryCache.fetch(successTransactionQuery(typeParam, idTransaction))
+      .then((resData) => {
+        if (active && resData?.status && resData.data) convertTransaction(resData.data);
+      })
+      .catch((err: any) => console.log('refresh success transaction error', err?.response));
+    return () => {
+      active = false;
+    };
+  }, [idTransaction]);
 
   const convertTransaction = (transactionData: any) => {
     if (!transactionData) return;
@@ -130,15 +141,15 @@ const SuccessTransactionDetailScreen = () => {
       const mapped: SuccessTransactionDetail = {
         id: String(d.id),
         type: 'sell',
-        amount: parseFloat(String(d.amount_vnd_real ?? '')).toLocaleString('vi-VN'),
+        amount: formatVND(d.amount_vnd_real),
         usdt: String(d.amount_usdt ?? ''),
-        exchangeRate: parseFloat(String(d.rate ?? '')).toLocaleString('vi-VN'),
+        exchangeRate: formatVND(d.rate),
         status: 1,
-        date: d.created_at ? new Date(d.created_at).toLocaleDateString('vi-VN') : new Date().toLocaleDateString('vi-VN'),
-        time: d.created_at ? new Date(d.created_at).toLocaleTimeString('vi-VN', { hour: '2-digit', minute: '2-digit' }) : new Date().toLocaleTimeString('vi-VN', { hour: '2-digit', minute: '2-digit' }),
+        date: formatDate(d.created_at || Date.now()),
+        time: formatTime(d.created_at || Date.now()),
         transactionId: d.transaction_hash || '',
-        fee: `${(d.fee_vnd ?? 0).toLocaleString('vi-VN')} VND`,
-        totalAmount: `${(d.amount_vnd_real ?? 0).toLocaleString('vi-VN')} VND`,
+        fee: `${formatVND(d.fee_vnd ?? 0)} VND`,
+        totalAmount: `${formatVND(d.amount_vnd_real ?? 0)} VND`,
         receiveAddress: d.address || undefined,
         createdAt: d.created_at || undefined,
         transferInfo: {
@@ -146,7 +157,7 @@ const SuccessTransactionDetailScreen = () => {
           accountNumber: d.bank_account || '',
           accountName: d.bank_address || '',
           transferContent: d.transaction_hash || '',
-          amount: (d.amount_vnd_real ?? 0).toLocaleString('vi-VN'),
+          amount: formatVND(d.amount_vnd_real ?? 0),
         },
       };
       setTransaction(mapped);
@@ -154,15 +165,15 @@ const SuccessTransactionDetailScreen = () => {
       const mapped: SuccessTransactionDetail = {
         id: String(d.id),
         type: 'buy',
-        amount: parseFloat(String(d.amount_vnd ?? '')).toLocaleString('vi-VN'),
+        amount: formatVND(d.amount_vnd),
         usdt: String(d.amount_usdt ?? ''),
-        exchangeRate: parseFloat(String(d.rate ?? '')).toLocaleString('vi-VN'),
+        exchangeRate: formatVND(d.rate),
         status: 1,
-        date: d.created_at ? new Date(d.created_at).toLocaleDateString('vi-VN') : new Date().toLocaleDateString('vi-VN'),
-        time: d.created_at ? new Date(d.created_at).toLocaleTimeString('vi-VN', { hour: '2-digit', minute: '2-digit' }) : new Date().toLocaleTimeString('vi-VN', { hour: '2-digit', minute: '2-digit' }),
+        date: formatDate(d.created_at || Date.now()),
+        time: formatTime(d.created_at || Date.now()),
         transactionId: d.transaction_hash || '',
-        fee: `${(d.fee_vnd ?? 0).toLocaleString('vi-VN')} VND`,
-        totalAmount: `${(d.amount_vnd_real ?? 0).toLocaleString('vi-VN')} VND`,
+        fee: `${formatVND(d.fee_vnd ?? 0)} VND`,
+        totalAmount: `${formatVND(d.amount_vnd_real ?? 0)} VND`,
         qrPayload: d.transaction_hash || undefined,
         createdAt: d.created_at || undefined,
         receiveAddress: d.address || undefined,
@@ -171,7 +182,7 @@ const SuccessTransactionDetailScreen = () => {
           accountNumber: d.bank_account || '',
           accountName: d.bank_address || '',
           transferContent: d.transaction_hash || '',
-          amount: (d.amount_vnd_real ?? 0).toLocaleString('vi-VN'),
+          amount: formatVND(d.amount_vnd_real ?? 0),
         },
       };
       setTransaction(mapped);
@@ -180,13 +191,8 @@ const SuccessTransactionDetailScreen = () => {
 
   const formatCreatedAt = (createdAt: string) => {
     try {
-      const date = new Date(createdAt);
-      const dateStr = date.toLocaleDateString('vi-VN');
-      const timeStr = date.toLocaleTimeString('vi-VN', { 
-        hour: '2-digit', 
-        minute: '2-digit',
-        hour12: false 
-      });
+      const dateStr = formatDate(createdAt);
+      const timeStr = formatTime(createdAt);
       return `${dateStr} • ${timeStr}`;
     } catch (error) {
       console.error('Error formatting createdAt:', error);
@@ -39,7 +39,7 @@ type TRC20Address = {
 
 const TRC20AddressesScreen = () => {
   const navigation = useNavigation();
-  const { t } = useTranslation();
+  const { t } = useTranslation('bank');
   const [addresses, setAddresses] = useState<TRC20Address[]>([]);
   const [loading, setLoading] = useState(true);
   const [refreshing, setRefreshing] = useState(false);
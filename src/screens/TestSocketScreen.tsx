@@ -10,14 +10,15 @@ import {
 } from 'react-native';
 import { SafeAreaView } from 'react-native-safe-area-context';
 import { useSocket } from '../contexts/SocketContext';
-import { useNotificationStore } from '../socket/notificationStore';
+import { useNotificationList, useNotificationStore } from '../socket/notificationStore';
 import { useEchoChannel } from '../hooks/useEcho';
 import { getToken } from '../utils/TokenManager';
 import { initEcho, getEcho, joinChannel, listenToEvent } from '../socket/echo';
 
 const TestSocketScreen: React.FC = () => {
   const { isConnected, isInitialized } = useSocket();
-  const { list, push, clear, remove } = useNotificationStore();
+  const { push, clear, remove } = useNotificationStore();
+  const list = useNotificationList();
   const [customMessage, setCustomMessage] = useState('');
   const [token, setToken] = useState<string | null>(null);
 
@@ -69,7 +70,7 @@ const TestSocketScreen: React.FC = () => {
 
   const handleRemoveLast = () => {
     if (list.length > 0) {
-      const lastNotification = list[list.length - 1];
+      const lastNotification = list[0]; // newest first
       remove(lastNotification.id);
     }
   };
@@ -6,16 +6,28 @@ import {
   TouchableOpacity,
   SafeAreaView,
   Platform,
+  useWindowDimensions,
 } from 'react-native';
 import LinearGradient from 'react-native-linear-gradient';
 import Icon from 'react-native-vector-icons/MaterialCommunityIcons';
+import { useFocusEffect } from '@react-navigation/native';
 import { theme } from '../theme/colors';
+import RateChart from '../component/RateChart';
+import { ExchangeRateService, rateTicks, useExchangeRateStore } from '../services/ExchangeRateService';
+import { formatUSDT, formatVND } from '../utils/format';
 
 const TradeScreen = () => {
   const [activeTab, setActiveTab] = useState<'buy' | 'sell'>('buy');
   const [amount, setAmount] = useState('0');
   const [selectedCoin, setSelectedCoin] = useState('USDT');
-  const exchangeRate = 26.389; // Mock exchange rate
+  // Live rate from the shared feed; 0 until the first value arrives
+  const exchangeRate = useExchangeRateStore((s) => s.rate);
+  const { width } = useWindowDimensions();
+
+  // Keeps the shared feed (and so the chart's ticks) running while visible
+  useFocusEffect(
+    React.useCallback(() => ExchangeRateService.acquire(), [])
+  );
 
   const shortcutAmounts = [
     { label: '300K', value: '300000' },
@@ -101,10 +113,21 @@ const TradeScreen = () => {
 
       {/* Exchange Rate */}
       <View style={styles.exchangeRate}>
-        <Text style={styles.exchangeText}>₫ {amount} = {(Number(amount) / exchangeRate).toFixed(2)} USDT</Text>
-        <Text style={styles.rateText}>1 USDT = {exchangeRate} VND</Text>
+        <Text style={styles.exchangeText}>
+          ₫ {amount} = {exchangeRate ? formatUSDT(Number(amount) / exchangeRate) : '—'} USDT
+        </Text>
+        <Text style={styles.rateText}>1 USDT = {exchangeRate ? formatVND(exchangeRate) : '—'} VND</Text>
       </View>
 
+      {/* Rate History */}
+      <RateChart
+        ring={rateTicks}
+        width={width - theme.spacing.lg * 2}
+        height={120}
+        color={theme.colors.primary}
+        style={styles.rateChart}
+      />
+
       {/* Shortcut Amounts */}
       <View style={styles.shortcutContainer}>
         {shortcutAmounts.map((item, index) => (
@@ -163,6 +186,10 @@ const styles = StyleSheet.create({
     borderRadius: 50,
     backgroundColor: theme.colors.secondary + '10',
   },
+  rateChart: {
+    alignSelf: 'center',
+    marginBottom: theme.spacing.md,
+  },
   header: {
     flexDirection: 'row',
     alignItems: 'center',
@@ -0,0 +1,175 @@
+// services/ExchangeRateService.ts
+import { create } from 'zustand';
+import { batcher } from '../utils/Api';
+import { getEcho } from '../socket/echo';
+import { isQuoteUsable, parseQuote, refreshAt } from '../utils/rateQuote';
+import { createTickRing } from '../utils/rateHistory';
+
+// One rate feed for the whole app: pushed over the Echo connection when the server
+// broadcasts it, with a single shared poller as fallback. Screens subscribe to the
+// store with selectors, so a tick only re-renders what actually reads the value.
+// When the server issues locked quotes, the feed holds the current one and fetches
+// the next just before it expires; orders are sent with its id.
+
+// Public channel/event broadcast by the backend on each rate change
+const RATE_CHANNEL = 'exchange-rate';
+const RATE_EVENT = '.ExchangeRateUpdatedEvent';
+
+// Poll period for a plain rate; a pushed rate pushes the next poll back by a full period
+export const RATE_REFRESH_INTERVAL = 20 * 1000;
+
+type RateSource = 'socket' | 'poll';
+
+type RateState = {
+  rate: number; // 0 until the first value arrives
+  fee: number | null;
+  // Server-locked quote behind `rate`, null when the server sends a plain rate
+  quoteId: string | null;
+  expiresAt: number | null;
+  updatedAt: number;
+  nextRefreshAt: number;
+  source: RateSource | null;
+  isLoading: boolean;
+};
+
+// Every rate seen this session, for charts (~40 hours of 20s polls)
+export const RATE_HISTORY_CAPACITY = 8192;
+export const rateTicks = createTickRing(RATE_HISTORY_CAPACITY);
+
+export const useExchangeRateStore = create<RateState>(() => ({
+  rate: 0,
+  fee: null,
+  quoteId: null,
+  expiresAt: null,
+  updatedAt: 0,
+  nextRefreshAt: 0,
+  source: null,
+  isLoading: false,
+}));
+
+let consumers = 0;
+let pollTimer: ReturnType<typeof setTimeout> | null = null;
+let inFlight: Promise<void> | null = null;
+let subscribedEcho: any = null;
+
+const publish = (data: any, source: RateSource) => {
+  const now = Date.now();
+  const quote = parseQuote(data, now);
+  if (!quote) return false;
+
+  // Every rate seen goes on the chart, including broadcasts held back below
+  rateTicks.push(now, quote.rate);
+
+  const prev = useExchangeRateStore.getState();
+  // A broadcast without a quote id does not replace a live locked quote: the
+  // locked rate is the one orders get until it expires
+  if (!quote.quoteId && prev.quoteId && isQuoteUsable(prev, now)) return false;
+
+  useExchangeRateStore.setState({
+    rate: quote.rate,
+    fee: quote.fee ?? prev.fee,
+    quoteId: quote.quoteId,
+    expiresAt: quote.expiresAt,
+    updatedAt: now,
+    nextRefreshAt: refreshAt(quote, now, RATE_REFRESH_INTERVAL),
+    source,
+  });
+  return true;
+};
+
+const schedulePoll = () => {
+  if (pollTimer) clearTimeout(pollTimer);
+  pollTimer = null;
+  if (consumers === 0) return;
+  const delay = Math.max(0, useExchangeRateStore.getState().nextRefreshAt - Date.now());
+  pollTimer = setTimeout(tick, delay);
+};
+
+// The socket may come up (or be replaced) after the first consumer, so retry on every tick
+const ensureSubscribed = () => {
+  const echo = getEcho();
+  if (!echo || echo === subscribedEcho) return;
+  try {
+    (echo as any).channel(RATE_CHANNEL).listen(RATE_EVENT, (data: any) => {
+      if (publish(data, 'socket')) schedulePoll();
+    });
+    subscribedEcho = echo;
+  } catch (error) {
+    console.log('Rate channel subscribe error:', error);
+  }
+};
+
+const fetchRate = () => {
+  if (inFlight) return inFlight;
+  useExchangeRateStore.setState({ isLoading: true });
+  inFlight = batcher
+    .get('/client/exchange/rate')
+    .then((response) => {
+      if (!publish(response.data, 'poll')) throw new Error('Invalid rate format');
+    })
+    .catch((error) => {
+      // Keep the last known rate; try again next period
+      console.log('Exchange rate fetch error:', error?.message ?? error);
+      useExchangeRateStore.setState({ nextRefreshAt: Date.now() + RATE_REFRESH_INTERVAL });
+    })
+    .finally(() => {
+      inFlight = null;
+      useExchangeRateStore.setState({ isLoading: false });
+    });
+  return inFlight;
+};
+
+const tick = async () => {
+  pollTimer = null;
+  ensureSubscribed();
+  await fetchRate();
+  schedulePoll();
+};
+
+export const ExchangeRateService = {
+  // Start (or join) the shared feed; returns the release function
+  acquire() {
+    consumers++;
+    if (consumers === 1) {
+      ensureSubscribed();
+      // Fetch right away if the last value is due, otherwise resume the countdown
+      if (Date.now() >= useExchangeRateStore.getState().nextRefreshAt) {
+        tick();
+      } else {
+        schedulePoll();
+      }
+    }
+    let released = false;
+    return () => {
+      if (released) return;
+      released = true;
+      consumers--;
+      if (consumers === 0) schedulePoll();
+    };
+  },
+
+  // Manual refresh (e.g. tapping the rate)
+  async refresh() {
+    await fetchRate();
+    schedulePoll();
+  },
+
+  // The quote an order should carry: the current one while it has time left,
+  // otherwise a fresh one. Without server quotes this is the last rate, no call.
+  async ensureQuote() {
+    const state = useExchangeRateStore.getState();
+    if (state.rate && isQuoteUsable(state, Date.now())) return state;
+    await fetchRate();
+    schedulePoll();
+    return useExchangeRateStore.getState();
+  },
+
+  // The server refused the quote (expired early, revoked): drop it and fetch another
+  async invalidateQuote() {
+    useExchangeRateStore.setState({ quoteId: null, expiresAt: null, nextRefreshAt: 0 });
+    await fetchRate();
+    schedulePoll();
+  },
+};
+
+export default ExchangeRateService;
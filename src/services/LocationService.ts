@@ -0,0 +1,111 @@
+// services/LocationService.ts
+import { AppState, AppStateStatus, NativeEventSubscription } from 'react-native';
+import Geolocation from 'react-native-geolocation-service';
+
+export interface LocationData {
+  lat: number;
+  long: number;
+}
+
+// Fallback used until the first fix arrives (Đà Nẵng)
+const DEFAULT_LOCATION: LocationData = {
+  lat: 16.068882379104995,
+  long: 108.24535024604958,
+};
+
+// Low duty cycle: one sample every 5 minutes, only while the app is in foreground
+const SAMPLE_INTERVAL = 5 * 60 * 1000;
+
+let currentLocation: LocationData = DEFAULT_LOCATION;
+// Pre-serialized header so the request interceptor does no work per request
+let locationHeader = JSON.stringify(DEFAULT_LOCATION);
+let lastSampleTime = 0;
+let sampleTimer: ReturnType<typeof setInterval> | null = null;
+let appStateSubscription: NativeEventSubscription | null = null;
+let isSampling = false;
+
+const updateLocation = (location: LocationData) => {
+  currentLocation = location;
+  locationHeader = JSON.stringify(location);
+};
+
+const sample = () => {
+  if (isSampling) return;
+  isSampling = true;
+
+  Geolocation.getCurrentPosition(
+    (position) => {
+      isSampling = false;
+      lastSampleTime = Date.now();
+      updateLocation({
+        lat: position.coords.latitude,
+        long: position.coords.longitude,
+      });
+    },
+    (error) => {
+      isSampling = false;
+      // Keep the last known location. lastSampleTime stays put, so a return to the
+      // foreground samples again at once; otherwise the next interval tick does
+      console.log('Location sample error:', error.message);
+    },
+    {
+      enableHighAccuracy: false,
+      timeout: 10000, // Off the request path, so we can afford to wait
+      maximumAge: SAMPLE_INTERVAL,
+      showLocationDialog: false,
+      forceRequestLocation: false,
+    }
+  );
+};
+
+const resume = () => {
+  if (Date.now() - lastSampleTime >= SAMPLE_INTERVAL) {
+    sample();
+  }
+  if (!sampleTimer) {
+    sampleTimer = setInterval(sample, SAMPLE_INTERVAL);
+  }
+};
+
+const pause = () => {
+  if (sampleTimer) {
+    clearInterval(sampleTimer);
+    sampleTimer = null;
+  }
+};
+
+const handleAppStateChange = (state: AppStateStatus) => {
+  if (state === 'active') {
+    resume();
+  } else {
+    pause();
+  }
+};
+
+export const LocationService = {
+  // Idempotent, safe to call from the request interceptor
+  start() {
+    if (appStateSubscription) return;
+    appStateSubscription = AppState.addEventListener('change', handleAppStateChange);
+    if (AppState.currentState === 'active') {
+      resume();
+    }
+  },
+
+  stop() {
+    pause();
+    appStateSubscription?.remove();
+    appStateSubscription = null;
+  },
+
+  getLocation(): LocationData {
+    return currentLocation;
+  },
+
+  // Value for the `x-location` header, always ready synchronously
+  getHeader(): string {
+    return locationHeader;
+  },
+};
+
+export default LocationService;
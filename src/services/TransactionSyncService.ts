@@ -0,0 +1,150 @@
+// services/TransactionSyncService.ts
+import AsyncStorage from '@react-native-async-storage/async-storage';
+import CryptoJS from 'crypto-js';
+import api, { responseBytes } from '../utils/Api';
+import KVStore from '../utils/kvStore';
+import { createHistorySync, HistoryCheckpoint, HistoryPage } from '../utils/historySync';
+import { parseTimestamp } from '../utils/timeIndex';
+import { TransactionRecord, useTransactionStore } from '../socket/transactionStore';
+
+// Local copy of the transaction history, kept current by cursor-based deltas.
+// Screens call sync() on focus and loadOlder() near the end of the list; the rows
+// land in the normalized transaction store that the socket events also patch.
+
+const HISTORY_URL = '/client/transactions/history';
+const STORAGE_KEY = 'tx-history';
+const PERSIST_DELAY = 1000;
+// Rows kept across restarts; anything older is paged in again on scroll
+const PERSIST_LIMIT = 500;
+// Page size when a date filter reaches past the synced rows
+const RANGE_PAGE_SIZE = 200;
+
+type Persisted = {
+  owner: string;
+  checkpoint: HistoryCheckpoint;
+  rows: TransactionRecord[];
+};
+
+// The server answers { status: false } until the account is verified
+export class VerificationRequiredError extends Error {
+  constructor() {
+    super('Verification required');
+    this.name = 'VerificationRequiredError';
+  }
+}
+
+let persistTimer: ReturnType<typeof setTimeout> | null = null;
+let hydrated: Promise<void> | null = null;
+
+const ownerKey = () => {
+  const token = KVStore.getString('token');
+  return token ? CryptoJS.SHA256(token).toString().slice(0, 16) : '';
+};
+
+const schedulePersist = () => {
+  if (persistTimer) return;
+  persistTimer = setTimeout(() => {
+    persistTimer = null;
+    const { ids, byId } = useTransactionStore.getState();
+    const kept = ids.slice(0, PERSIST_LIMIT);
+    const checkpoint = historySync.checkpoint();
+    const value: Persisted = {
+      owner: ownerKey(),
+      checkpoint: kept.length < ids.length
+        ? {
+            ...checkpoint,
+            // Paging resumes below the last kept row (or the last paged one, if higher)
+            oldestId: Math.max(checkpoint.oldestId ?? 0, kept[kept.length - 1]),
+            complete: false,
+          }
+        : checkpoint,
+      rows: kept.map((id) => byId[id]),
+    };
+    AsyncStorage.setItem(STORAGE_KEY, JSON.stringify(value)).catch((error) => {
+      console.log('History persist error:', error);
+    });
+  }, PERSIST_DELAY);
+};
+
+const historySync = createHistorySync<TransactionRecord>({
+  request: async (params) => {
+    const response = await api.get<HistoryPage<TransactionRecord> & { status?: boolean }>(HISTORY_URL, {
+      params,
+      // A legacy full reply can be large: decode off the critical path
+      decodeLargeJson: true,
+    });
+    if (response.data.status === false) throw new VerificationRequiredError();
+    return { page: response.data, bytes: responseBytes(response) };
+  },
+  replace: (list) => useTransactionStore.getState().setAll(list),
+  merge: (list) => useTransactionStore.getState().merge(list),
+  onCheckpoint: schedulePersist,
+});
+
+// Restore the last synced rows so the list paints before the first delta returns
+const hydrate = () => {
+  if (!hydrated) {
+    hydrated = Promise.all([KVStore.ready(), AsyncStorage.getItem(STORAGE_KEY)])
+      .then(([, json]) => {
+        if (!json) return;
+        const saved: Persisted = JSON.parse(json);
+        // Another account's history is never shown
+        if (saved.owner !== ownerKey()) return;
+        const store = useTransactionStore.getState();
+        if (store.ids.length === 0) store.setAll(saved.rows);
+        historySync.restore(saved.checkpoint);
+      })
+      .catch((error) => {
+        console.log('History hydrate error:', error);
+      });
+  }
+  return hydrated;
+};
+
+export const TransactionSyncService = {
+  hydrate,
+
+  // Fetches only what changed since the last sync
+  async sync() {
+    await hydrate();
+    await historySync.sync();
+    const { lastSyncBytes, lastSyncRows } = historySync.stats();
+    console.log(`History sync: ${lastSyncRows} rows, ${lastSyncBytes} bytes`);
+  },
+
+  async loadOlder() {
+    await hydrate();
+    await historySync.loadOlder();
+  },
+
+  hasOlder: () => !historySync.checkpoint().complete,
+
+  // Pages in older rows until everything created at or after `from` is local.
+  // Filters inside the synced span never reach the server.
+  async ensureSince(from: number) {
+    await hydrate();
+    for (;;) {
+      const { complete, oldestId } = historySync.checkpoint();
+      if (complete || oldestId == null) return;
+      const oldest = useTransactionStore.getState().byId[oldestId];
+      if (parseTimestamp(oldest?.created_at) < from) return;
+      await historySync.loadOlder(RANGE_PAGE_SIZE);
+    }
+  },
+
+  stats: () => historySync.stats(),
+
+  // Logout: forget rows and cursor
+  async reset() {
+    if (persistTimer) {
+      clearTimeout(persistTimer);
+      persistTimer = null;
+    }
+    historySync.restore(null);
+    useTransactionStore.getState().setAll([]);
+    hydrated = Promise.resolve();
+    await AsyncStorage.removeItem(STORAGE_KEY).catch(() => {});
+  },
+};
+
+export default TransactionSyncService;
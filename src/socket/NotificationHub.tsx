@@ -1,37 +1,31 @@
-import React, { useEffect, useState } from 'react';
-import { useNotificationStore } from './notificationStore';
+import React from 'react';
+import { selectToast, useNotificationStore } from './notificationStore';
 import ToastCustom, { ToastData } from '../component/ToastCustom';
 
 export const NotificationHub = () => {
-    const list = useNotificationStore((s) => s.list);
-    const remove = useNotificationStore((s) => s.remove);
-    const [currentToast, setCurrentToast] = useState<ToastData | null>(null);
+    // Only the toast slice: new history entries that are not toasts don't re-render this
+    const toast = useNotificationStore(selectToast);
+    const dismissToast = useNotificationStore((s) => s.dismissToast);
 
-    useEffect(() => {
-        if (list.length === 0) {
-            setCurrentToast(null);
-            return;
-        }
-        
-        const last = list[list.length - 1];
-        
-        // Only show if it's a new notification (not already showing)
-        if (!currentToast || currentToast.id !== last.id) {
-            setCurrentToast({
-                id: last.id,
-                title: last.title,
-                message: last.message,
-                type: last.type,
-                duration: 5000, 
-            });
-        }
-    }, [list, currentToast]);
+    const currentToast: ToastData | null = React.useMemo(
+        () =>
+            toast
+                ? {
+                      id: toast.id,
+                      title: toast.title,
+                      message: toast.message,
+                      type: toast.type,
+                      duration: 5000,
+                  }
+                : null,
+        [toast],
+    );
 
     const handleHideToast = () => {
+        // Dismissing a toast keeps the entry in history (NotificationsScreen)
         if (currentToast) {
-            remove(currentToast.id);
+            dismissToast(currentToast.id);
         }
-        setCurrentToast(null);
     };
 
     return (
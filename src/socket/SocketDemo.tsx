@@ -1,7 +1,7 @@
 import React from 'react';
 import { View, Text, Button, StyleSheet, ScrollView } from 'react-native';
 import { useSocket } from '../contexts/SocketContext';
-import { useNotificationStore } from './notificationStore';
+import { useNotificationList, useNotificationStore } from './notificationStore';
 import { useEchoChannel } from '../hooks/useEcho';
 
 /**
@@ -10,7 +10,8 @@ import { useEchoChannel } from '../hooks/useEcho';
  */
 export const SocketDemo: React.FC = () => {
   const { isConnected, isInitialized } = useSocket();
-  const { list, push, clear } = useNotificationStore();
+  const { push, clear } = useNotificationStore();
+  const list = useNotificationList();
 
   // Demo: Listen to custom events
   useEchoChannel('notifications', '.DemoEvent', (data) => {
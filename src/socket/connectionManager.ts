@@ -0,0 +1,284 @@
+import { AppState, AppStateStatus, NativeEventSubscription } from 'react-native';
+import AsyncStorage from '@react-native-async-storage/async-storage';
+import CryptoJS from 'crypto-js';
+import { initEcho, disconnectEcho, fetchTokenChannel } from './echo';
+import { computeBackoff } from '../utils/retryPolicy';
+
+// Owns the Echo/Pusher connection for the whole app:
+//   idle -> connecting -> connected
+//                      -> waiting (backoff with jitter) -> connecting
+//   any  -> paused (app in background) -> connecting (foreground)
+// Pusher's own retry loop is cut short on failure so backoff stays in one place.
+// Channel subscriptions survive reconnects; listeners are told how long the gap
+// was so they can catch up on events missed while offline.
+
+export type ConnectionState = 'idle' | 'connecting' | 'connected' | 'waiting' | 'paused';
+
+export type GapInfo = { from: number; to: number };
+
+type EventHandler = (data: any) => void;
+
+const CHANNEL_CACHE_KEY = 'ws-channel';
+const RECONNECT_BASE = 1000;
+const RECONNECT_CAP = 30 * 1000;
+
+let state: ConnectionState = 'idle';
+let token: string | null = null;
+let echo: any = null;
+let channelName: string | null = null;
+let channel: any = null;
+let attempt = 0;
+let reconnectTimer: ReturnType<typeof setTimeout> | null = null;
+let appStateSubscription: NativeEventSubscription | null = null;
+// Set while we close the connection ourselves, so the resulting 'disconnected' is not a failure
+let closingOnPurpose = false;
+// When the live connection dropped unexpectedly (metrics), and when events may
+// have started being missed, drops and background pauses alike (gap detection)
+let lostAt: number | null = null;
+let gapFrom: number | null = null;
+let hasConnected = false;
+
+const handlers = new Map<string, Set<EventHandler>>();
+const stateListeners = new Set<(s: ConnectionState) => void>();
+const gapListeners = new Set<(gap: GapInfo) => void>();
+
+const metrics = {
+  reconnects: 0,
+  disconnectedMs: 0,
+  lastConnectedAt: 0,
+};
+
+const setState = (next: ConnectionState) => {
+  if (state === next) return;
+  state = next;
+  stateListeners.forEach((l) => l(next));
+};
+
+const tokenKey = (t: string) => CryptoJS.SHA256(t).toString().slice(0, 16);
+
+// The channel only depends on the token: fetch it once, then serve from memory/disk
+const resolveChannel = async (t: string) => {
+  const key = tokenKey(t);
+  try {
+    const cached = JSON.parse((await AsyncStorage.getItem(CHANNEL_CACHE_KEY)) || 'null');
+    if (cached?.key === key && cached.channel) return cached.channel as string;
+  } catch (e) {
+    // fall through to the network
+  }
+  const name = await fetchTokenChannel(t);
+  AsyncStorage.setItem(CHANNEL_CACHE_KEY, JSON.stringify({ key, channel: name })).catch(() => {});
+  return name;
+};
+
+const bindHandlers = (event: string) => {
+  channel?.listen(event, (data: any) => handlers.get(event)?.forEach((h) => h(data)));
+};
+
+const onConnected = () => {
+  const now = Date.now();
+  attempt = 0;
+  metrics.lastConnectedAt = now;
+  if (lostAt != null) {
+    metrics.disconnectedMs += now - lostAt;
+    metrics.reconnects++;
+    lostAt = null;
+  }
+  if (gapFrom != null) {
+    const gap = { from: gapFrom, to: now };
+    gapFrom = null;
+    // Pusher resubscribes channels itself; listeners refetch what they missed
+    gapListeners.forEach((l) => l(gap));
+  }
+  hasConnected = true;
+  setState('connected');
+};
+
+const onLost = () => {
+  if (!hasConnected) return;
+  const now = Date.now();
+  lostAt = lostAt ?? now;
+  gapFrom = gapFrom ?? now;
+};
+
+const scheduleReconnect = () => {
+  if (reconnectTimer || state === 'paused' || !token) return;
+  const delay = computeBackoff(attempt++, Math.random, RECONNECT_BASE, RECONNECT_CAP);
+  console.log(`[WS] Reconnecting in ${delay}ms (attempt ${attempt})`);
+  setState('waiting');
+  reconnectTimer = setTimeout(() => {
+    reconnectTimer = null;
+    connect();
+  }, delay);
+};
+
+const handleStateChange = ({ current }: { previous: string; current: string }) => {
+  // Our own background disconnect
+  if (state === 'paused' && current !== 'connected') return;
+  switch (current) {
+    case 'connected':
+      onConnected();
+      break;
+    case 'connecting':
+      if (state !== 'paused') setState('connecting');
+      break;
+    case 'unavailable':
+    case 'failed':
+      onLost();
+      // Take over from pusher's fixed retry loop
+      closingOnPurpose = true;
+      echo?.connector.pusher.disconnect();
+      closingOnPurpose = false;
+      scheduleReconnect();
+      break;
+    case 'disconnected':
+      onLost();
+      if (!closingOnPurpose) scheduleReconnect();
+      break;
+  }
+};
+
+const connect = () => {
+  if (!echo || state === 'paused') return;
+  setState('connecting');
+  echo.connector.pusher.connect();
+};
+
+const disconnect = () => {
+  if (reconnectTimer) {
+    clearTimeout(reconnectTimer);
+    reconnectTimer = null;
+  }
+  if (!echo) return;
+  closingOnPurpose = true;
+  echo.connector.pusher.disconnect();
+  closingOnPurpose = false;
+};
+
+const handleAppState = (next: AppStateStatus) => {
+  if (!echo) return;
+  if (next === 'active') {
+    if (state === 'paused') {
+      state = 'idle';
+      attempt = 0;
+      connect();
+    }
+  } else if (state !== 'paused') {
+    // No socket in the background; not counted as downtime, but the gap is reported on resume
+    const now = Date.now();
+    if (lostAt != null) {
+      metrics.disconnectedMs += now - lostAt;
+      lostAt = null;
+    }
+    if (hasConnected) gapFrom = gapFrom ?? now;
+    setState('paused');
+    disconnect();
+  }
+};
+
+export const SocketManager = {
+  // Idempotent for the same token; a new token replaces the connection
+  async start(nextToken: string) {
+    if (token === nextToken && echo) return;
+    if (echo) SocketManager.stop();
+    token = nextToken;
+
+    echo = initEcho(nextToken);
+    const pusher = echo.connector.pusher;
+    pusher.connection.bind('state_change', handleStateChange);
+    pusher.connection.bind('error', (error: any) => {
+      console.log('[WS] Error:', error);
+    });
+    if (!appStateSubscription) {
+      appStateSubscription = AppState.addEventListener('change', handleAppState);
+    }
+    if (AppState.currentState !== 'active') {
+      setState('paused');
+      disconnect();
+    } else if (pusher.connection.state === 'connected') {
+      onConnected();
+    } else {
+      setState('connecting');
+    }
+
+    try {
+      const name = await resolveChannel(nextToken);
+      if (token !== nextToken) return; // stopped or replaced meanwhile
+      channelName = name;
+      channel = echo.private(name);
+      channel.subscription.bind('pusher:subscription_succeeded', () => {
+        console.log('[WS] Subscribed to', `private-${name}`);
+      });
+      channel.subscription.bind('pusher:subscription_error', (err: any) => {
+        console.log('[WS] Subscription error:', err);
+      });
+      handlers.forEach((_, event) => bindHandlers(event));
+    } catch (error) {
+      console.log('[WS] Channel resolve error:', error);
+    }
+  },
+
+  stop() {
+    if (reconnectTimer) {
+      clearTimeout(reconnectTimer);
+      reconnectTimer = null;
+    }
+    if (echo && channelName) echo.leave(`private-${channelName}`);
+    closingOnPurpose = true;
+    disconnectEcho();
+    closingOnPurpose = false;
+    appStateSubscription?.remove();
+    appStateSubscription = null;
+    echo = null;
+    channel = null;
+    channelName = null;
+    token = null;
+    attempt = 0;
+    lostAt = null;
+    gapFrom = null;
+    hasConnected = false;
+    setState('idle');
+  },
+
+  // Listen on the user's private channel; survives reconnects and token changes
+  listen(event: string, handler: EventHandler) {
+    let set = handlers.get(event);
+    if (!set) {
+      set = new Set();
+      handlers.set(event, set);
+      bindHandlers(event);
+    }
+    set.add(handler);
+    return () => {
+      set!.delete(handler);
+    };
+  },
+
+  onStateChange(listener: (s: ConnectionState) => void) {
+    stateListeners.add(listener);
+    return () => {
+      stateListeners.delete(listener);
+    };
+  },
+
+  // Called after a reconnect with the window during which events may have been missed
+  onGap(listener: (gap: GapInfo) => void) {
+    gapListeners.add(listener);
+    return () => {
+      gapListeners.delete(listener);
+    };
+  },
+
+  getState: () => state,
+
+  getMetrics() {
+    const pending = lostAt != null ? Date.now() - lostAt : 0;
+    return {
+      state,
+      reconnects: metrics.reconnects,
+      disconnectedMs: metrics.disconnectedMs + pending,
+      lastConnectedAt: metrics.lastConnectedAt,
+    };
+  },
+};
+
+export default SocketManager;
@@ -6,9 +6,26 @@ import Pusher from 'pusher-js/react-native';
 global.Pusher = Pusher;
 
 // Cấu hình server của bạn
-const API_BASE = 'https://mimo.dragonlab.vn';
-const BROADCAST_HOST = 'mimo.dragonlab.vn';
-const PUSHER_KEY = 'mgo7rulpwxlwtslgbr4k';
+let API_BASE = 'https://mimo.dragonlab.vn';
+let BROADCAST_HOST = 'mimo.dragonlab.vn';
+let BROADCAST_PORT = 443;
+let FORCE_TLS = true;
+let PUSHER_KEY = 'mgo7rulpwxlwtslgbr4k';
+
+// Point the socket at another server (e.g. scripts/pusher-standin.mjs); call before initEcho
+export const configureEcho = (options: {
+    apiBase?: string;
+    host?: string;
+    port?: number;
+    forceTLS?: boolean;
+    key?: string;
+}) => {
+    API_BASE = options.apiBase ?? API_BASE;
+    BROADCAST_HOST = options.host ?? BROADCAST_HOST;
+    BROADCAST_PORT = options.port ?? BROADCAST_PORT;
+    FORCE_TLS = options.forceTLS ?? FORCE_TLS;
+    PUSHER_KEY = options.key ?? PUSHER_KEY;
+};
 
 let echoInstance: Echo<any> | null = null;
 
@@ -18,9 +35,9 @@ export const initEcho = (token: string) => {
     const pusher = new Pusher(PUSHER_KEY, {
         cluster: 'mt1', // Thay đổi cluster của bạn
         wsHost: BROADCAST_HOST,
-        wsPort: 443,
-        wssPort: 443,
-        forceTLS: true,
+        wsPort: BROADCAST_PORT,
+        wssPort: BROADCAST_PORT,
+        forceTLS: FORCE_TLS,
         enabledTransports: ['ws', 'wss'],
         disableStats: true,
 
@@ -1,38 +1,272 @@
+import { useMemo } from 'react';
 import { create } from 'zustand';
+import AsyncStorage from '@react-native-async-storage/async-storage';
+
+// Bounded notification history: a fixed-capacity ring buffer with an id -> slot map,
+// so push, remove and mark-read are O(1) and memory stays flat for the app's lifetime.
+// The zustand state only carries what screens select on (version, unread counters,
+// current toast); the buffer itself is mutated in place.
+
+export type NotificationCategory = 'transaction' | 'security' | 'system';
 
 export type UINotification = {
     id: string;
     title?: string;
     message: string;
     type?: 'info' | 'success' | 'warning' | 'error';
+    category?: NotificationCategory;
     at?: number;
+    read?: boolean;
     raw?: any;
 };
 
+export const NOTIFICATION_CAPACITY = 100;
+
+const STORAGE_KEY = 'notifications';
+const PERSIST_DELAY = 500;
+const TYPES = ['info', 'success', 'warning', 'error'] as const;
+const CATEGORIES: NotificationCategory[] = ['transaction', 'security', 'system'];
+
+type UnreadCounts = Record<NotificationCategory, number>;
+
+// Ring buffer; removed entries leave a hole that is reclaimed when the ring wraps over it
+const slots: (UINotification | undefined)[] = new Array(NOTIFICATION_CAPACITY);
+const slotById = new Map<string, number>();
+let head = 0; // oldest slot
+let used = 0; // slots between head and tail, holes included
+// Microsecond-spaced seed keeps ids increasing across restarts without persisting a counter
+let nextSeq = Date.now() * 1000;
+// Toasts shown newest first; stale ids are skipped lazily
+const toastStack: string[] = [];
+let persistTimer: ReturnType<typeof setTimeout> | null = null;
+let hydrated: Promise<void> | null = null;
+
+const emptyCounts = (): UnreadCounts => ({ transaction: 0, security: 0, system: 0 });
+
+const categoryOf = (n: UINotification): NotificationCategory => n.category ?? 'system';
+
+const vacate = (slot: number, unread: UnreadCounts) => {
+    const entry = slots[slot];
+    if (!entry) return;
+    slots[slot] = undefined;
+    slotById.delete(entry.id);
+    if (!entry.read) unread[categoryOf(entry)]--;
+};
+
+const insert = (entry: UINotification, unread: UnreadCounts) => {
+    if (used === NOTIFICATION_CAPACITY) {
+        // Full: overwrite the oldest slot
+        vacate(head, unread);
+        head = (head + 1) % NOTIFICATION_CAPACITY;
+        used--;
+    }
+    const slot = (head + used) % NOTIFICATION_CAPACITY;
+    slots[slot] = entry;
+    slotById.set(entry.id, slot);
+    used++;
+    if (!entry.read) unread[categoryOf(entry)]++;
+};
+
+// Oldest -> newest, skipping holes
+const toArray = () => {
+    const list: UINotification[] = [];
+    for (let i = 0; i < used; i++) {
+        const entry = slots[(head + i) % NOTIFICATION_CAPACITY];
+        if (entry) list.push(entry);
+    }
+    return list;
+};
+
+const topToast = () => {
+    while (toastStack.length) {
+        const slot = slotById.get(toastStack[toastStack.length - 1]);
+        if (slot != null) return slots[slot]!;
+        toastStack.pop();
+    }
+    return null;
+};
+
+// Compact form: [id, at, type, category, read, title, message]; raw payloads are not kept
+type PersistedEntry = [string, number, number, number, 0 | 1, string, string];
+
+const schedulePersist = () => {
+    if (persistTimer) return;
+    persistTimer = setTimeout(() => {
+        persistTimer = null;
+        const rows: PersistedEntry[] = toArray().map((n) => [
+            n.id,
+            n.at ?? 0,
+            Math.max(0, TYPES.indexOf(n.type ?? 'info')),
+            CATEGORIES.indexOf(categoryOf(n)),
+            n.read ? 1 : 0,
+            n.title ?? '',
+            n.message,
+        ]);
+        AsyncStorage.setItem(STORAGE_KEY, JSON.stringify(rows)).catch((error) => {
+            console.log('Notification persist error:', error);
+        });
+    }, PERSIST_DELAY);
+};
+
 type State = {
-    list: UINotification[];
-    push: (n: Omit<UINotification, 'id' | 'at'>) => void;
-    clear: () => void;
+    // Bumped on every change to the buffer contents
+    version: number;
+    unread: UnreadCounts;
+    toast: UINotification | null;
+    push: (n: Omit<UINotification, 'id' | 'at'>) => string;
+    // One state update for a burst; only the newest entry is toasted
+    pushMany: (list: Omit<UINotification, 'id' | 'at'>[]) => string[];
     remove: (id: string) => void;
+    markRead: (id: string) => void;
+    markAllRead: () => void;
+    dismissToast: (id: string) => void;
+    clear: () => void;
 };
 
-export const useNotificationStore = create<State>((set) => ({
-    list: [],
-    push: (n) =>
+export const useNotificationStore = create<State>((set, get) => {
+    const commit = (unread: UnreadCounts, toastChanged = false) => {
         set((s) => ({
-            list: [
-                ...s.list,
-                {
-                    id: `${Date.now()}-${Math.random()}`,
-                    at: Date.now(),
-                    type: n.type ?? 'info',
+            version: s.version + 1,
+            unread,
+            ...(toastChanged ? { toast: topToast() } : null),
+        }));
+        schedulePersist();
+    };
+
+    return {
+        version: 0,
+        unread: emptyCounts(),
+        toast: null,
+        push: (n) => get().pushMany([n])[0],
+        pushMany: (list) => {
+            if (list.length === 0) return [];
+            const unread = { ...get().unread };
+            const at = Date.now();
+            const ids = list.map((n) => {
+                const entry: UINotification = {
+                    type: 'info',
                     ...n,
-                },
-            ],
-        })),
-    clear: () => set({ list: [] }),
-    remove: (id) =>
-        set((s) => ({
-            list: s.list.filter((n) => n.id !== id),
-        })),
-}));
+                    id: String(nextSeq++),
+                    at,
+                    read: false,
+                };
+                insert(entry, unread);
+                return entry.id;
+            });
+            toastStack.push(ids[ids.length - 1]);
+            commit(unread, true);
+            return ids;
+        },
+        remove: (id) => {
+            const slot = slotById.get(id);
+            if (slot == null) return;
+            const unread = { ...get().unread };
+            vacate(slot, unread);
+            // Trim holes at either end so `used` tracks the live span
+            while (used > 0 && !slots[head]) {
+                head = (head + 1) % NOTIFICATION_CAPACITY;
+                used--;
+            }
+            while (used > 0 && !slots[(head + used - 1) % NOTIFICATION_CAPACITY]) used--;
+            commit(unread, get().toast?.id === id);
+        },
+        markRead: (id) => {
+            const slot = slotById.get(id);
+            const entry = slot != null ? slots[slot] : undefined;
+            if (!entry || entry.read) return;
+            // Replace the object so row-level memoization sees the change
+            slots[slot!] = { ...entry, read: true };
+            const unread = { ...get().unread };
+            unread[categoryOf(entry)]--;
+            commit(unread);
+        },
+        markAllRead: () => {
+            for (let i = 0; i < used; i++) {
+                const slot = (head + i) % NOTIFICATION_CAPACITY;
+                const entry = slots[slot];
+                if (entry && !entry.read) slots[slot] = { ...entry, read: true };
+            }
+            commit(emptyCounts());
+        },
+        dismissToast: (id) => {
+            const index = toastStack.lastIndexOf(id);
+            if (index >= 0) toastStack.splice(index, 1);
+            set({ toast: topToast() });
+        },
+        clear: () => {
+            slots.fill(undefined);
+            slotById.clear();
+            toastStack.length = 0;
+            head = 0;
+            used = 0;
+            set((s) => ({ version: s.version + 1, unread: emptyCounts(), toast: null }));
+            schedulePersist();
+        },
+    };
+});
+
+// Restore persisted history; entries pushed before this resolves stay newest
+export const hydrateNotifications = () => {
+    if (!hydrated) {
+        const job: Promise<void> = AsyncStorage.getItem(STORAGE_KEY)
+            .then((json) => {
+                // Reset (logout) while reading: the rows belong to the previous account
+                if (!json || hydrated !== job) return;
+                const rows: PersistedEntry[] = JSON.parse(json);
+                const current = toArray();
+                slots.fill(undefined);
+                slotById.clear();
+                head = 0;
+                used = 0;
+                const unread = emptyCounts();
+                for (const [id, at, type, category, read, title, message] of rows) {
+                    if (slotById.has(id)) continue;
+                    insert({
+                        id,
+                        at,
+                        type: TYPES[type] ?? 'info',
+                        category: CATEGORIES[category] ?? 'system',
+                        read: read === 1,
+                        title: title || undefined,
+                        message,
+                    }, unread);
+                    nextSeq = Math.max(nextSeq, Number(id) + 1);
+                }
+                current.forEach((entry) => insert(entry, unread));
+                useNotificationStore.setState((s) => ({ version: s.version + 1, unread }));
+            })
+            .catch((error) => {
+                console.log('Notification hydrate error:', error);
+            });
+        hydrated = job;
+    }
+    return hydrated;
+};
+
+// Drops the history from memory and disk on logout: messages carry amounts and bank
+// account numbers, so they must not be shown to the next account on this device
+export const resetNotifications = () => {
+    useNotificationStore.getState().clear();
+    if (persistTimer) {
+        clearTimeout(persistTimer);
+        persistTimer = null;
+    }
+    hydrated = null;
+    return AsyncStorage.removeItem(STORAGE_KEY).catch((error) => {
+        console.log('Notification reset error:', error);
+    });
+};
+
+// Selectors
+export const selectToast = (s: State) => s.toast;
+export const selectVersion = (s: State) => s.version;
+export const selectUnreadTotal = (s: State) =>
+    s.unread.transaction + s.unread.security + s.unread.system;
+export const selectUnread = (category: NotificationCategory) => (s: State) => s.unread[category];
+
+// Newest first; rebuilt only when the buffer changes
+export const useNotificationList = () => {
+    const version = useNotificationStore(selectVersion);
+    // eslint-disable-next-line react-hooks/exhaustive-deps
+    return useMemo(() => toArray().reverse(), [version]);
+};
@@ -0,0 +1,68 @@
+import { createSearchIndex, foldText, queryTokens } from '../utils/searchIndex';
+import { type TransactionRecord, useTransactionStore } from './transactionStore';
+
+// Search over the synced history: note (order code), transaction hash, bank name,
+// account number and amounts. The index follows the transaction store lazily: the
+// first query after a change re-indexes only the records whose object changed.
+
+const index = createSearchIndex();
+// id -> record object last indexed
+const indexed = new Map<number, TransactionRecord>();
+let indexedById: Record<number, TransactionRecord> | null = null;
+let indexedIds: number[] | null = null;
+
+const amountTerms = (value?: number) => {
+    if (value == null || isNaN(Number(value))) return [];
+    const plain = String(value);
+    // 100.50 is also found as "100.5"; integers as their digits
+    return [plain, String(Number(value))];
+};
+
+export const transactionTerms = (tx: TransactionRecord) => {
+    const hash = (tx.transaction_hash ?? '').toLowerCase();
+    return [
+        ...(tx.note ? foldText(tx.note).split(/[^a-z0-9]+/) : []),
+        // Whole note too, so "mimo0001" matches across separators
+        tx.note ? foldText(tx.note).replace(/[^a-z0-9]/g, '') : '',
+        hash,
+        hash.startsWith('0x') ? hash.slice(2) : '',
+        ...(tx.bank_name ? foldText(tx.bank_name).split(/\s+/) : []),
+        tx.bank_account ? String(tx.bank_account).replace(/\D/g, '') : '',
+        ...amountTerms(tx.amount_usdt),
+        ...amountTerms(tx.amount_vnd),
+        ...amountTerms(tx.amount_vnd_real),
+    ];
+};
+
+const syncIndex = () => {
+    const { ids, byId } = useTransactionStore.getState();
+    if (byId === indexedById) return;
+    for (const id of ids) {
+        const tx = byId[id];
+        const previous = indexed.get(id);
+        if (previous === tx) continue;
+        index.set(id, transactionTerms(tx), previous && transactionTerms(previous));
+        indexed.set(id, tx);
+    }
+    // Dropped rows (reset, account switch)
+    if (ids !== indexedIds) {
+        indexed.forEach((previous, id) => {
+            if (!byId[id]) {
+                index.remove(id, transactionTerms(previous));
+                indexed.delete(id);
+            }
+        });
+    }
+    indexedById = byId;
+    indexedIds = ids;
+};
+
+// Ids matching every word of the query by prefix; null for an empty query
+export const searchTransactions = (query: string): Set<number> | null => {
+    const tokens = queryTokens(query);
+    if (tokens.length === 0) return null;
+    syncIndex();
+    return index.search(tokens);
+};
+
+export const transactionSearchStats = () => index.size();
@@ -0,0 +1,213 @@
+import { create } from 'zustand';
+import { buildTimeIndex, parseTimestamp, type TimeIndex } from '../utils/timeIndex';
+
+// Normalized transactions keyed by id. History loads fill it; socket transfer events
+// are applied as field-level patches so open screens update without a refetch.
+
+export type TransactionRecord = {
+    id: number;
+    type?: number;
+    note?: string;
+    status?: number;
+    amount_usdt?: number;
+    amount_vnd?: number;
+    amount_vnd_real?: number;
+    rate?: number;
+    fee_percent?: number;
+    fee_vnd?: number;
+    transaction_hash?: string | null;
+    [key: string]: any;
+};
+
+// Fields a transfer event is allowed to overwrite
+const PATCH_FIELDS = [
+    'status',
+    'amount_usdt',
+    'amount_vnd',
+    'amount_vnd_real',
+    'rate',
+    'fee_percent',
+    'fee_vnd',
+    'transaction_hash',
+] as const;
+
+export type StatusBucket = 'pending' | 'success' | 'fail';
+
+// History tabs: 0 = pending, 1 = success, 2/3/4 = failed / cancelled / expired
+export const bucketOf = (status?: number): StatusBucket | null => {
+    if (status === 0) return 'pending';
+    if (status === 1) return 'success';
+    if (status === 2 || status === 3 || status === 4) return 'fail';
+    return null;
+};
+
+type Buckets = Record<StatusBucket, number[]>;
+
+type State = {
+    byId: Record<number, TransactionRecord>;
+    // History order (newest first, as returned by the server)
+    ids: number[];
+    // note (order code) -> id, for events that carry no id
+    idByNote: Record<string, number>;
+    // ids per history tab, kept in history order and moved on status changes
+    buckets: Buckets;
+    // id -> index in `ids`, for ordered inserts into a bucket
+    position: Record<number, number>;
+    // ids by created_at, for date filters; rebuilt only when rows are added or removed
+    timeline: TimeIndex;
+    setAll: (list: TransactionRecord[]) => void;
+    // Upsert a page of full records from incremental sync, keeping newest-first order
+    merge: (list: TransactionRecord[]) => void;
+    upsert: (record: TransactionRecord) => void;
+    applyEvent: (event: any) => boolean;
+    // Burst form: one store update for the whole batch
+    applyEvents: (events: any[]) => number;
+};
+
+const resolveId = (s: State, event: any): number | undefined => {
+    const raw = event?.id_transaction ?? event?.transaction_id ?? event?.id;
+    if (raw != null && !isNaN(Number(raw))) return Number(raw);
+    return event?.note ? s.idByNote[event.note] : undefined;
+};
+
+// Structural equality for JSON values (records are parsed API payloads)
+const sameValue = (a: any, b: any): boolean => {
+    if (a === b) return true;
+    if (!a || !b || typeof a !== 'object' || typeof b !== 'object') return false;
+    if (Array.isArray(a) !== Array.isArray(b)) return false;
+    const keys = Object.keys(a);
+    if (keys.length !== Object.keys(b).length) return false;
+    return keys.every((key) => sameValue(a[key], b[key]));
+};
+
+// Keep the previous object only when the server sent the same record, so row
+// memoization holds; any changed field (amounts, fee, bank details, note) replaces it
+const reuse = (prev: TransactionRecord | undefined, tx: TransactionRecord) =>
+    prev && sameValue(prev, tx) ? prev : tx;
+
+const indexHistory = (ids: number[], byId: Record<number, TransactionRecord>) => {
+    const position: Record<number, number> = {};
+    const buckets: Buckets = { pending: [], success: [], fail: [] };
+    ids.forEach((id, i) => {
+        position[id] = i;
+        const bucket = bucketOf(byId[id].status);
+        if (bucket) buckets[bucket].push(id);
+    });
+    return { position, buckets };
+};
+
+const timelineOf = (ids: number[], byId: Record<number, TransactionRecord>) =>
+    buildTimeIndex(ids, (id) => parseTimestamp(byId[id].created_at));
+
+// Insert keeping history order; buckets are small sorted runs of `ids` positions
+const insertOrdered = (bucket: number[], id: number, position: Record<number, number>) => {
+    const at = position[id];
+    let lo = 0;
+    let hi = bucket.length;
+    while (lo < hi) {
+        const mid = (lo + hi) >>> 1;
+        if (position[bucket[mid]] < at) lo = mid + 1;
+        else hi = mid;
+    }
+    bucket.splice(lo, 0, id);
+};
+
+export const useTransactionStore = create<State>((set, get) => ({
+    byId: {},
+    ids: [],
+    idByNote: {},
+    buckets: { pending: [], success: [], fail: [] },
+    position: {},
+    timeline: { at: [], ids: [] },
+    setAll: (list) => {
+        const byId: Record<number, TransactionRecord> = {};
+        const idByNote: Record<string, number> = {};
+        const ids: number[] = [];
+        for (const tx of list) {
+            byId[tx.id] = reuse(get().byId[tx.id], tx);
+            if (tx.note) idByNote[tx.note] = tx.id;
+            ids.push(tx.id);
+        }
+        set({ byId, ids, idByNote, ...indexHistory(ids, byId), timeline: timelineOf(ids, byId) });
+    },
+    merge: (list) => {
+        if (list.length === 0) return;
+        const s = get();
+        const byId = { ...s.byId };
+        const idByNote = { ...s.idByNote };
+        const addedIds = new Set<number>();
+        for (const tx of list) {
+            if (s.position[tx.id] == null) addedIds.add(tx.id);
+            byId[tx.id] = reuse(s.byId[tx.id], tx);
+            if (tx.note) idByNote[tx.note] = tx.id;
+        }
+        let ids = s.ids;
+        let timeline = s.timeline;
+        if (addedIds.size) {
+            // Ids grow with creation time; merge the new ones into the descending run
+            const added = Array.from(addedIds).sort((a, b) => b - a);
+            ids = [];
+            let i = 0;
+            let j = 0;
+            while (i < s.ids.length || j < added.length) {
+                if (j >= added.length || (i < s.ids.length && s.ids[i] > added[j])) ids.push(s.ids[i++]);
+                else ids.push(added[j++]);
+            }
+            timeline = timelineOf(ids, byId);
+        }
+        set({ byId, ids, idByNote, ...indexHistory(ids, byId), timeline });
+    },
+    upsert: (record) =>
+        set((s) => ({
+            byId: { ...s.byId, [record.id]: { ...s.byId[record.id], ...record } },
+            idByNote: record.note ? { ...s.idByNote, [record.note]: record.id } : s.idByNote,
+        })),
+    applyEvent: (event) => get().applyEvents([event]) > 0,
+    applyEvents: (events) => {
+        const s = get();
+        let byId: Record<number, TransactionRecord> | null = null;
+        // Only the buckets an event moves between are copied
+        let buckets: Buckets | null = null;
+        const copied = new Set<StatusBucket>();
+        let matched = 0;
+        for (const event of events) {
+            const id = resolveId(s, event);
+            const prev = id != null ? (byId ?? s.byId)[id] : undefined;
+            if (!prev) continue;
+            matched++;
+
+            const patch: Partial<TransactionRecord> = {};
+            let changed = false;
+            for (const field of PATCH_FIELDS) {
+                if (event[field] === undefined) continue;
+                const value = field === 'status' ? Number(event[field]) : event[field];
+                if (prev[field] !== value) {
+                    patch[field] = value;
+                    changed = true;
+                }
+            }
+            if (!changed) continue;
+            // Copy the map once per batch, not once per event
+            byId = byId ?? { ...s.byId };
+            byId[id!] = { ...prev, ...patch };
+
+            const from = bucketOf(prev.status);
+            const to = bucketOf(byId[id!].status);
+            if (from === to || s.position[id!] == null) continue;
+            buckets = buckets ?? { ...s.buckets };
+            for (const key of [from, to]) {
+                if (key && !copied.has(key)) {
+                    buckets[key] = buckets[key].slice();
+                    copied.add(key);
+                }
+            }
+            if (from) {
+                const index = buckets[from].indexOf(id!);
+                if (index >= 0) buckets[from].splice(index, 1);
+            }
+            if (to) insertOrdered(buckets[to], id!, s.position);
+        }
+        if (byId) set(buckets ? { byId, buckets } : { byId });
+        return matched;
+    },
+}));
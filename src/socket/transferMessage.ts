@@ -0,0 +1,90 @@
+import type { UINotification } from './notificationStore';
+import { dateTimeFormat, formatVND, numberFormat } from '../utils/format';
+import { formatPercent } from '../utils/money';
+
+// Toast/notification text for .NotificationSuccessTransferEvent.
+// Formatters come from the shared pool: constructing Intl objects per event dominated burst cost.
+
+type Translate = (key: string, options?: any) => string;
+
+// Device locale, as the toast used before
+const sentAtFormat = dateTimeFormat(undefined, {
+  year: 'numeric',
+  month: 'numeric',
+  day: 'numeric',
+  hour: 'numeric',
+  minute: 'numeric',
+  second: 'numeric',
+});
+
+const toVND = (n?: number) => (n == null ? '-' : `${formatVND(n)} ₫`);
+const toUSDT = (n?: number) => (n == null ? '-' : `${numberFormat('vi-VN').format(n)} USDT`);
+
+// Same transaction reported twice in a burst collapses to its latest state
+export const transferKey = (data: any) =>
+  data?.id_transaction ?? data?.transaction_id ?? data?.id ?? data?.note ?? data?.transaction_hash;
+
+export const buildTransferNotification = (
+  data: any,
+  t: Translate,
+): Omit<UINotification, 'id' | 'at'> => {
+  const {
+    amount_usdt,
+    amount_vnd,
+    amount_vnd_real,
+    rate,
+    fee_percent,
+    fee_vnd,
+    sent_at,
+    status,
+  } = data ?? {};
+
+  const time = sent_at ? sentAtFormat.format(new Date(sent_at)) : '-';
+
+  const ok = Number(status) === 1;
+  // `type` is the trade direction (1/2), not a toast severity
+  const toastType = ok ? 'success' : 'error';
+  
+  // Determine transaction type based on type field
+  // type = 1: Buy USDT (VND → USDT)
+  // type = 2: Sell USDT (USDT → VND)
+  const isBuyTransaction = Number(data.type) === 1;
+  const isSellTransaction = Number(data.type) === 2;
+  
+  const transactionTypeText = isSellTransaction ? t('detailHistory.sellUsdt') : 
+                             isBuyTransaction ? t('detailHistory.buyUsdt') : 
+                             t('toast.transaction');
+  
+  const title = ok ? t('toast.transactionSuccess') : t('toast.transactionFailed');
+   
+  let message = '';
+  
+  if (isSellTransaction) {
+    // Sell USDT transaction message
+    message =
+      `${transactionTypeText}\n` +
+      `${t('toast.amount')}: ${toUSDT(amount_usdt)} → ${toVND(amount_vnd_real)}\n` +
+      `${t('toast.exchangeRate')}: ${rate ? formatVND(rate) : '-'} | ${t('toast.fee')}: ${toVND(fee_vnd)} (${formatPercent(fee_percent)}%)\n` +
+      `${t('toast.bankName')}: ${data.bank_name || '-'}\n` +
+      `${t('toast.accountNumber')}: ${data.bank_account || '-'}\n` +
+      `${t('toast.time')}: ${time}`;
+  } else if (isBuyTransaction) {
+    // Buy USDT transaction message
+    message =
+      `${transactionTypeText}\n` +
+      `${t('toast.amount')}: ${toVND(amount_vnd)} → ${toUSDT(amount_usdt)}\n` +
+      `${t('toast.exchangeRate')}: ${rate ? formatVND(rate) : '-'} | ${t('toast.fee')}: ${toVND(fee_vnd)} (${formatPercent(fee_percent)}%)\n` +
+      `${t('toast.bankName')}: ${data.bank_name || '-'}\n` +
+      `${t('toast.accountNumber')}: ${data.bank_account || '-'}\n` +
+      `${t('toast.time')}: ${time}`;
+  } else {
+    // Generic transaction message
+    message =
+      `${t('toast.transaction')}\n` +
+      `${t('toast.amount')}: ${toUSDT(amount_usdt)} / ${toVND(amount_vnd_real)}\n` +
+      `${t('toast.exchangeRate')}: ${rate ? formatVND(rate) : '-'} | ${t('toast.fee')}: ${toVND(fee_vnd)} (${formatPercent(fee_percent)}%)\n` +
+      `${t('toast.time')}: ${time}`;
+  }
+
+  return { title, message, type: toastType, category: 'transaction', raw: data };
+};
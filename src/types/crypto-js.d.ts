@@ -0,0 +1,17 @@
+// Minimal typings for the parts of crypto-js we use (no @types/crypto-js in the tree)
+declare module 'crypto-js' {
+  interface WordArray {
+    toString(encoder?: Encoder): string;
+  }
+  interface Encoder {
+    stringify(wordArray: WordArray): string;
+  }
+  const CryptoJS: {
+    SHA256(message: string | WordArray): WordArray;
+    enc: {
+      Utf8: Encoder;
+      Hex: Encoder;
+    };
+  };
+  export default CryptoJS;
+}
@@ -0,0 +1,12 @@
+// Minimal typings for qrcode's matrix API (no @types/qrcode in the tree)
+declare module 'qrcode' {
+  export type QRCodeErrorCorrectionLevel = 'L' | 'M' | 'Q' | 'H';
+  export interface QRCode {
+    modules: {
+      size: number;
+      data: Uint8Array;
+    };
+    version: number;
+  }
+  export function create(text: string, options?: { errorCorrectionLevel?: QRCodeErrorCorrectionLevel }): QRCode;
+}
@@ -1,9 +1,21 @@
-import axios from "axios";
+import axios, { AxiosError } from "axios";
 import { Alert, Platform } from 'react-native';
 import { deriveDashboardStats, deriveRecentBatches, mockUsers } from './mockData';
 import { getToken, removeToken, saveToken } from "./TokenManager";
 import { navigate, resetTo } from "../navigation/NavigationService";
-import Geolocation from 'react-native-geolocation-service';
+import LocationService from '../services/LocationService';
+import {
+  CircuitBreaker,
+  computeBackoff,
+  generateIdempotencyKey,
+  getHost,
+  getRetryPolicy,
+  isHostFailure,
+  isRetryableError,
+} from './retryPolicy';
+import { createRequestBatcher } from './requestBatcher';
+import { decodeJsonSliced, getLargeJsonThreshold } from './jsonDecoder';
+import { ApiMetrics, now, RequestTiming, routeTemplate } from './apiMetrics';
 import i18n from '../i18n';
 
 // Types
@@ -40,70 +52,23 @@ export interface UserProfile {
   profile_image: string;
 }
 
-// Location interface
-interface LocationData {
-  lat: number;
-  long: number;
+declare module 'axios' {
+  interface AxiosRequestConfig {
+    // Stable across retries; pass one per order to dedupe double submits too
+    idempotencyKey?: string;
+    retryCount?: number;
+    // Bodies above the large-JSON threshold are decoded in time slices (see jsonDecoder)
+    decodeLargeJson?: boolean;
+    // Phase timestamps for ApiMetrics, reset on every attempt
+    timing?: RequestTiming;
+    // Set when this attempt is the breaker's half-open probe
+    breakerProbe?: boolean;
+  }
 }
 
-// Cache location to avoid repeated calls
-let cachedLocation: LocationData | null = null;
-let locationCacheTime = 0;
-const LOCATION_CACHE_DURATION = 5 * 60 * 1000; // 5 minutes
-
 // Guard to prevent multiple simultaneous alerts
 let isShowingAuthAlert = false;
 
-// Function to get current location with caching
-const getCurrentLocation = (): Promise<LocationData | null> => {
-  return new Promise((resolve) => {
-    // Return cached location if still valid
-    const now = Date.now();
-    if (cachedLocation && (now - locationCacheTime) < LOCATION_CACHE_DURATION) {
-      console.log('Using cached location:', cachedLocation);
-      resolve(cachedLocation);
-      return;
-    }
-
-    Geolocation.getCurrentPosition(
-      (position) => {
-        const { latitude, longitude } = position.coords;
-        const location = {
-          lat: latitude,
-          long: longitude,
-        };
-        console.log('Location obtained:', location);
-        // Cache the location
-        cachedLocation = location;
-        locationCacheTime = now;
-        
-        resolve(location);
-      },
-      (error) => {
-        console.log('Location error:', error.message);
-        const defaultLocation = {
-          lat: 16.068882379104995,
-          long: 108.24535024604958,
-        };
-        
-        // Cache default location too
-        cachedLocation = defaultLocation;
-        locationCacheTime = now;
-        
-        resolve(defaultLocation);
-      },
-      {
-        enableHighAccuracy: false, // Use less accurate but faster location
-        timeout: 1000, // Reduced timeout to 1 second
-        maximumAge: 300000, // 5 minutes cache
-        showLocationDialog: false, // Don't show system dialog
-        forceRequestLocation: false, // Use cached location if available
-      }
-    );
-  });
-};
-
-
 const baseUrl = Platform.select({
   ios: 'https://mimo.dragonlab.vn/api',
   android: 'https://mimo.dragonlab.vn/api',
@@ -124,72 +89,132 @@ const api = axios.create({
   },
 });
 
+const breaker = new CircuitBreaker();
+
+// Payload size from what is already in memory, nothing is re-serialized
+export const responseBytes = (response: any) => {
+  const lengthHeader = Number(response?.headers?.['content-length']);
+  return lengthHeader > 0
+    ? lengthHeader
+    : typeof response?.request?.responseText === 'string' ? response.request.responseText.length : 0;
+};
+
+// Records one attempt
+const recordMetrics = (config: any, response: any, failed: boolean) => {
+  if (!config?.timing) return;
+  const bytesIn = responseBytes(response);
+  const bytesOut = typeof config.data === 'string' ? config.data.length : 0;
+  ApiMetrics.record(routeTemplate(config.method, config.url), config.timing, bytesIn, bytesOut, failed);
+};
+
 api.interceptors.request.use(async (config) => {
+  const timing = config.timing;
+  if (timing) timing.interceptorStart = now();
+
   // Add Authorization header
   const token = await getToken();
+  if (timing) timing.tokenDone = now();
   if (token) {
     console.log('token', token);
     config.headers.Authorization = `Bearer ${token}`;
   }
   
-  // Get location asynchronously without blocking the request
-  getCurrentLocation().then((location) => {
-    if (location) {
-      config.headers['x-location'] = JSON.stringify(location);
-      console.log('Location header added:', location);
-    }
-  }).catch((error) => {
-    console.log('Location error in interceptor:', error);
-  });
+  // Location is sampled in the background, the header is already serialized
+  LocationService.start();
+  config.headers['x-location'] = LocationService.getHeader();
 
+  if (getRetryPolicy(config.method, config.url).idempotent) {
+    config.idempotencyKey = config.idempotencyKey || generateIdempotencyKey();
+    config.headers['Idempotency-Key'] = config.idempotencyKey;
+  }
+
+  if (config.decodeLargeJson) {
+    // Keep the raw text; the response interceptor decides how to decode it
+    config.transformResponse = [(data) => data];
+  }
+
+  // Fail fast while the host is known to be down
+  const host = getHost(config.baseURL, config.url);
+  if (!breaker.canRequest(host)) {
+    throw new AxiosError('Circuit open', 'ECIRCUITOPEN', config);
+  }
+  // Still open yet allowed through: this attempt is the half-open probe
+  config.breakerProbe = breaker.isOpen(host);
+
+  if (timing) timing.sent = now();
   return config;
 });
 
-// Maximum number of retry attempts
-const MAX_RETRY_ATTEMPTS = 2;
-
-// Function to determine if we should retry the request
-const shouldRetry = (error: any, retryCount: number) => {
-  // Don't retry if we've exceeded max attempts
-  if (retryCount >= MAX_RETRY_ATTEMPTS) return false;
-
-  // Don't retry for specific error codes
-  if (error.response?.status === 422) return false; // Validation errors
-  if (error.response?.status === 403) return false; // Permission denied
-
-  // Retry on network errors, timeouts, and 401s
-  return (
-    !error.response || // Network error
-    error.code === 'ECONNABORTED' || // Timeout
-    /timeout/i.test(error.message) || // Timeout message
-    error.response.status === 401 || // Unauthorized
-    (error.response.status >= 500 && error.response.status <= 599) // Server errors
-  );
-};
+// Registered last so it runs first: marks when the request was issued
+api.interceptors.request.use((config) => {
+  config.timing = { start: now() };
+  return config;
+});
 
 api.interceptors.response.use(
-  (response) => {
+  async (response) => {
+    const timing = response.config.timing;
+    if (timing) timing.received = now();
+    breaker.recordSuccess(getHost(response.config.baseURL, response.config.url));
+    if (response.config.decodeLargeJson && typeof response.data === 'string') {
+      if (response.data.length < getLargeJsonThreshold()) {
+        response.data = response.data ? JSON.parse(response.data) : response.data;
+      } else {
+        const { value, stats } = await decodeJsonSliced(response.data);
+        response.data = value;
+        console.log('Sliced JSON decode:', response.config.url, stats);
+      }
+    }
+    if (timing) timing.parsed = now();
+    recordMetrics(response.config, response, false);
     return response;
   },
   async (error: any) => {
     const config = error.config;
-    
+    if (axios.isCancel(error)) {
+      // A cancelled probe (e.g. a superseded prefetch) says nothing about the host
+      if (config?.breakerProbe) breaker.releaseProbe(getHost(config.baseURL, config.url));
+      return Promise.reject(error);
+    }
+    if (!config || error.code === 'ECIRCUITOPEN') {
+      return Promise.reject(error);
+    }
+    if (config.timing) config.timing.received = now();
+    recordMetrics(config, error.response, true);
+
+    if (config.decodeLargeJson && typeof error.response?.data === 'string') {
+      try {
+        error.response.data = JSON.parse(error.response.data);
+      } catch {
+        // Not JSON, leave as text
+      }
+    }
+
+    const host = getHost(config.baseURL, config.url);
+    if (isHostFailure(error)) {
+      breaker.recordFailure(host);
+    } else {
+      breaker.recordSuccess(host);
+    }
+
     // Initialize retry count if it doesn't exist
     config.retryCount = config.retryCount || 0;
-    
+    const policy = getRetryPolicy(config.method, config.url);
+
     // Check if we should retry the request
-    if (shouldRetry(error, config.retryCount)) {
+    if (isRetryableError(error, policy, config.retryCount) && !breaker.isOpen(host)) {
       config.retryCount += 1;
-      
-      // Exponential backoff delay
-      const delayMs = Math.min(1000 * (2 ** config.retryCount), 10000);
-      
-      console.log(`Retrying request (attempt ${config.retryCount}/${MAX_RETRY_ATTEMPTS}) after ${delayMs}ms`);
-      
+      ApiMetrics.recordRetry(routeTemplate(config.method, config.url));
+
+      // Exponential backoff with full jitter
+      const delayMs = computeBackoff(config.retryCount);
+
+      console.log(`Retrying request (attempt ${config.retryCount}/${policy.maxRetries}) after ${delayMs}ms`);
+
       // Wait for the delay
       await new Promise(resolve => setTimeout(resolve, delayMs));
-      
-      // Retry the request
+
+      // Retry the request (same Idempotency-Key, set on config)
       return api(config);
     }
 
@@ -250,4 +275,12 @@ api.interceptors.response.use(
   }
 );
 
+// Dashboard GETs fired together (e.g. on focus) go out as one /client/batch call
+export const batcher = createRequestBatcher(api, {
+  // Sub-responses share the batch's timing; their bytes are counted on the batch route
+  onItem: (url, _status, batch) => {
+    if (batch.config.timing) ApiMetrics.record(routeTemplate('get', url), batch.config.timing, 0, 0, false);
+  },
+});
+
 export default api;
\ No newline at end of file
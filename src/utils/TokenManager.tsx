@@ -1,11 +1,19 @@
-import AsyncStorage from "@react-native-async-storage/async-storage";
 import { CommonActions, NavigationProp } from '@react-navigation/native';
 import api from "./Api";
 import Toast from "react-native-toast-message";
+import { ResponseCache } from "./responseCache";
+import { KVStore } from "./kvStore";
+import { QueryCache } from "./queryCache";
+import { QrImageCache } from "./qrImageCache";
+import { resetNotifications } from "../socket/notificationStore";
+import { TransactionSyncService } from "../services/TransactionSyncService";
 
 export const saveToken = async (token: string) => {
     try {
-        await AsyncStorage.setItem('token', token);
+        await KVStore.ready();
+        KVStore.setString('token', token);
+        ResponseCache.reset();
+        await KVStore.flushed();
         console.log('Token saved successfully');
     } catch (error) {
         console.error('Error saving token:', error);
@@ -15,7 +23,9 @@ export const saveToken = async (token: string) => {
 
 export const getToken = async () => {
     try {
-        return await AsyncStorage.getItem('token');
+        // Served from memory after the first call, no bridge round trip per request
+        await KVStore.ready();
+        return KVStore.getString('token');
     } catch (error) {
         console.error('Error getting token:', error);
         return null;
@@ -24,7 +34,17 @@ export const getToken = async () => {
 
 export const removeToken = async () => {
     try {
-        await AsyncStorage.removeItem('token');
+        await KVStore.ready();
+        KVStore.remove('token');
+        ResponseCache.reset();
+        QueryCache.clear();
+        QrImageCache.clear();
+        // Rows, cursor and hydrate flag: the next account must not sync from ours
+        const history = TransactionSyncService.reset();
+        const notifications = resetNotifications();
+        await KVStore.flushed();
+        // Per-user data on disk (plain JSON) goes with the session
+        await Promise.all([ResponseCache.clear(), notifications, history]);
         console.log('Token removed successfully');
     } catch (error) {
         console.error('Error removing token:', error);
@@ -80,7 +100,9 @@ export const checkToken = async (navigation: NavigationProp<any>) => {
 }
 export const saveUser = async (user: any) => {
     try {
-        await AsyncStorage.setItem('user', JSON.stringify(user));
+        await KVStore.ready();
+        KVStore.setObject('user', user);
+        await KVStore.flushed();
         console.log('User saved successfully');
     } catch (error) {
         console.error('Error saving user:', error);
@@ -89,8 +111,9 @@ export const saveUser = async (user: any) => {
 }
 export const getUser = async () => {
     try {
-        const user = await AsyncStorage.getItem('user');
-        return JSON.parse(user || '{}');
+        // Parsed once per save, not on every read
+        await KVStore.ready();
+        return KVStore.getObject('user') ?? {};
     } catch (error) {
         console.error('Error getting user:', error);
         return null;
@@ -98,7 +121,9 @@ export const getUser = async () => {
 }
 export const removeUser = async () => {
     try {
-        await AsyncStorage.removeItem('user');
+        await KVStore.ready();
+        KVStore.remove('user');
+        await KVStore.flushed();
         console.log('User removed successfully');
     } catch (error) {
         console.error('Error removing user:', error);
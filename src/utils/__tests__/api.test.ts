@@ -0,0 +1,112 @@
+import { AxiosError, type AxiosRequestConfig } from 'axios';
+import api from '../Api';
+
+jest.mock('react-native-get-random-values', () => ({}));
+jest.mock('../TokenManager', () => ({
+  getToken: jest.fn(async () => null),
+  removeToken: jest.fn(async () => {}),
+  saveToken: jest.fn(async () => {}),
+}));
+jest.mock('../../navigation/NavigationService', () => ({ navigate: jest.fn(), resetTo: jest.fn() }));
+jest.mock('../../services/LocationService', () => ({
+  __esModule: true,
+  default: { start: jest.fn(), getHeader: jest.fn(() => '') },
+}));
+jest.mock('../../i18n', () => ({ __esModule: true, default: { t: (key: string) => key } }));
+
+type Reply = { status: number; data?: any } | AxiosError['code'];
+
+// Replaces the network: each call records the request and answers with `reply(config)`
+const stubAdapter = (reply: (config: AxiosRequestConfig) => Reply) => {
+  const requests: AxiosRequestConfig[] = [];
+  api.defaults.adapter = async (config) => {
+    requests.push(config);
+    const result = reply(config);
+    if (typeof result === 'string') {
+      throw new AxiosError('timeout of 15000ms exceeded', result, config as any);
+    }
+    const response = { data: result.data, status: result.status, statusText: '', headers: {}, config: config as any };
+    if (result.status >= 400) {
+      throw new AxiosError('Request failed', 'ERR_BAD_RESPONSE', config as any, null, response);
+    }
+    return response;
+  };
+  return requests;
+};
+
+describe('api', () => {
+  let clock = 0;
+
+  beforeEach(() => {
+    // No backoff wait between retries; a controllable clock for the breaker cooldown
+    jest.spyOn(Math, 'random').mockReturnValue(0);
+    jest.spyOn(Date, 'now').mockImplementation(() => clock);
+  });
+
+  afterEach(() => {
+    jest.restoreAllMocks();
+  });
+
+  it('lets the next request probe when a half-open probe is cancelled', async () => {
+    clock = 0;
+    stubAdapter(() => ({ status: 503 }));
+    // Retries count too: two failed GETs open the breaker (threshold 5)
+    await expect(api.get('/client/profile')).rejects.toBeTruthy();
+    await expect(api.get('/client/profile')).rejects.toBeTruthy();
+    await expect(api.get('/client/profile')).rejects.toMatchObject({ code: 'ECIRCUITOPEN' });
+
+    // After the cooldown the probe is a prefetch that gets superseded
+    clock = 60 * 1000;
+    const controller = new AbortController();
+    controller.abort();
+    await expect(api.get('/client/profile', { signal: controller.signal })).rejects.toMatchObject({
+      name: 'CanceledError',
+    });
+
+    const requests = stubAdapter(() => ({ status: 200, data: { status: true } }));
+    await expect(api.get('/client/profile')).resolves.toMatchObject({ status: 200 });
+    expect(requests).toHaveLength(1);
+  });
+
+  it('creates exactly one order when attempts fail after the server committed', async () => {
+    const ORDER_URL = '/client/create-transactions/vnd-usdt';
+    const scenarios: Reply[][] = [
+      ['ECONNABORTED', { status: 200 }],
+      [{ status: 503 }, 'ECONNABORTED', { status: 200 }],
+      ['ECONNABORTED', { status: 504 }, { status: 200 }],
+    ];
+    for (const faults of scenarios) {
+      // Order endpoint: commits before each injected fault, dedupes by Idempotency-Key
+      const orders = new Map<string, number>();
+      let call = 0;
+      const requests = stubAdapter((config) => {
+        const key = (config.headers as any)['Idempotency-Key'];
+        if (!orders.has(key)) orders.set(key, orders.size + 1);
+        const fault = faults[call++] ?? { status: 200 };
+        return typeof fault === 'string' || fault.status >= 400
+          ? fault
+          : { status: 200, data: { status: true, id_transaction: orders.get(key) } };
+      });
+
+      const res = await api.post(ORDER_URL, { amount_vnd: 2640000 });
+      expect(res.data.id_transaction).toBe(1);
+      expect(orders.size).toBe(1);
+      expect(requests).toHaveLength(faults.length);
+      const keys = requests.map((config) => (config.headers as any)['Idempotency-Key']);
+      expect(keys[0]).toMatch(/^[0-9a-f]{8}-[0-9a-f]{4}-4[0-9a-f]{3}-[89ab][0-9a-f]{3}-[0-9a-f]{12}$/);
+      expect(new Set(keys).size).toBe(1);
+    }
+  });
+
+  it('dedupes a double submit that passes the same idempotency key', async () => {
+    const orders = new Set<string>();
+    stubAdapter((config) => {
+      orders.add((config.headers as any)['Idempotency-Key']);
+      return { status: 200, data: { status: true } };
+    });
+    const idempotencyKey = 'order-key-1';
+    await api.post('/client/create-transactions/usdt-vnd', {}, { idempotencyKey });
+    await api.post('/client/create-transactions/usdt-vnd', {}, { idempotencyKey });
+    expect([...orders]).toEqual([idempotencyKey]);
+  });
+});
@@ -0,0 +1,96 @@
+import { createEventPipeline } from '../eventPipeline';
+import { buildTransferNotification, transferKey } from '../../socket/transferMessage';
+
+const t = (key: string) => key;
+
+// Batch settlement: 1,000 events for 250 transactions, each reported pending -> success
+const makeBurst = (count: number, transactions: number) =>
+  Array.from({ length: count }, (_, i) => ({
+    id_transaction: (i % transactions) + 1,
+    type: (i % 2) + 1,
+    status: i < count - transactions ? 0 : 1,
+    amount_usdt: 100 + i,
+    amount_vnd: 2650000 + i,
+    amount_vnd_real: 2640000 + i,
+    rate: 26500,
+    fee_percent: 0.003,
+    fee_vnd: 7950,
+    sent_at: '2025-09-13T10:00:00.000000Z',
+  }));
+
+describe('createEventPipeline', () => {
+  it('coalesces a burst into one flush per frame, deduped by transaction', () => {
+    const frames: (() => void)[] = [];
+    const flushed: any[][] = [];
+    const pipeline = createEventPipeline<any>({
+      keyOf: transferKey,
+      flush: (batch) => flushed.push(batch),
+      schedule: (cb) => frames.push(cb),
+    });
+
+    const burst = makeBurst(1000, 250);
+    burst.forEach((e) => pipeline.enqueue(e));
+    expect(frames.length).toBe(1);
+    frames.shift()!();
+
+    expect(flushed.length).toBe(1);
+    expect(flushed[0].length).toBe(250);
+    // Last state of each transaction wins
+    expect(flushed[0].every((e) => e.status === 1)).toBe(true);
+    expect(pipeline.stats()).toEqual({ received: 1000, deduped: 750, flushes: 1, maxBatch: 250 });
+  });
+
+  it('keeps unkeyed messages and starts a new batch after a flush', () => {
+    const frames: (() => void)[] = [];
+    const flushed: any[][] = [];
+    const pipeline = createEventPipeline<any>({
+      keyOf: (m) => m.key,
+      flush: (batch) => flushed.push(batch),
+      schedule: (cb) => frames.push(cb),
+    });
+
+    pipeline.enqueue({ v: 1 });
+    pipeline.enqueue({ v: 2 });
+    frames.shift()!();
+    pipeline.enqueue({ key: 'a', v: 3 });
+    pipeline.drain();
+
+    expect(flushed.map((b) => b.map((m) => m.v))).toEqual([[1, 2], [3]]);
+  });
+
+  it('measures a 1,000 event burst against per-event handling', () => {
+    const burst = makeBurst(1000, 250);
+
+    // Before: a fresh formatter and a store update per event
+    let renders = 0;
+    const naiveStart = performance.now();
+    for (const data of burst) {
+      const nf = new Intl.NumberFormat('vi-VN');
+      `${nf.format(data.amount_usdt)} ${nf.format(data.amount_vnd_real)} ${new Date(data.sent_at).toLocaleString()}`;
+      renders++;
+    }
+    const naiveMs = performance.now() - naiveStart;
+
+    const frames: (() => void)[] = [];
+    let batchedRenders = 0;
+    const pipeline = createEventPipeline<any>({
+      keyOf: transferKey,
+      flush: (batch) => {
+        batch.map((data) => buildTransferNotification(data, t));
+        batchedRenders++;
+      },
+      schedule: (cb) => frames.push(cb),
+    });
+    const start = performance.now();
+    burst.forEach((e) => pipeline.enqueue(e));
+    while (frames.length) frames.shift()!();
+    const pipelineMs = performance.now() - start;
+
+    expect(batchedRenders).toBe(1);
+    console.log(
+      `[burst] 1000 events: per-event ${naiveMs.toFixed(1)}ms / ${renders} updates, ` +
+        `pipeline ${pipelineMs.toFixed(1)}ms / ${batchedRenders} update ` +
+        `(${Math.round(1000 / Math.max(pipelineMs, 0.001))} events/ms)`,
+    );
+  });
+});
@@ -0,0 +1,53 @@
+import { DATE_PLACEHOLDER, formatDate, formatTime, formatUSDT, formatVND, numberFormat } from '../format';
+
+const AMOUNTS = [0, 7, 950, 7950, 26450, 2640000, 1234567890, -2640000, 26450.5, 0.003, NaN];
+const USDT = [0, 1, 100.5, 1234.56, 99.999, 1.005, -12.3, 1e21];
+
+describe('format', () => {
+  it('matches toLocaleString output', () => {
+    AMOUNTS.forEach((n) => expect(formatVND(n)).toBe(n.toLocaleString('vi-VN')));
+    expect(formatVND('2640000')).toBe('2.640.000');
+    USDT.forEach((n) =>
+      expect(formatUSDT(n)).toBe(n.toLocaleString('en-US', { minimumFractionDigits: 2, maximumFractionDigits: 2 })),
+    );
+    const at = '2025-09-13T03:05:00.000000Z';
+    expect(formatDate(at)).toBe(new Date(at).toLocaleDateString('vi-VN'));
+    expect(formatTime(at)).toBe(new Date(at).toLocaleTimeString('vi-VN', { hour: '2-digit', minute: '2-digit', hour12: false }));
+    expect(numberFormat('vi-VN')).toBe(numberFormat('vi-VN'));
+  });
+
+  it('shows a placeholder for a missing or unparseable date', () => {
+    for (const value of ['not a date', '', null, undefined, NaN, new Date(NaN)]) {
+      expect(formatDate(value)).toBe(DATE_PLACEHOLDER);
+      expect(formatTime(value)).toBe(DATE_PLACEHOLDER);
+    }
+  });
+
+  it('benchmarks per-call cost against toLocaleString', () => {
+    const N = 20000;
+    const values = Array.from({ length: N }, (_, i) => 2640000 + i * 1000);
+    const time = (fn: (v: number) => string) => {
+      // Second pass, after the JIT has seen the call site
+      let ns = 0;
+      for (let pass = 0; pass < 2; pass++) {
+        const start = performance.now();
+        for (const v of values) fn(v);
+        ns = ((performance.now() - start) * 1e6) / N;
+      }
+      return ns;
+    };
+
+    const rows = [
+      ['toLocaleString(vi-VN)', time((v) => v.toLocaleString('vi-VN'))],
+      ['new Intl.NumberFormat per call', time((v) => new Intl.NumberFormat('vi-VN').format(v))],
+      ['cached numberFormat()', time((v) => numberFormat('vi-VN').format(v))],
+      ['formatVND (integer fast path)', time(formatVND)],
+      ['toLocaleString(en-US, 2dp)', time((v) => (v / 1000).toLocaleString('en-US', { minimumFractionDigits: 2, maximumFractionDigits: 2 }))],
+      ['formatUSDT', time((v) => formatUSDT(v / 1000))],
+      ['toLocaleDateString(vi-VN)', time((v) => new Date(v * 1000).toLocaleDateString('vi-VN'))],
+      ['formatDate', time((v) => formatDate(v * 1000))],
+    ] as const;
+    console.log(rows.map(([label, ns]) => `  ${label.padEnd(32)} ${ns.toFixed(0).padStart(6)} ns/call`).join('\n'));
+    expect(rows.length).toBe(8);
+  });
+});
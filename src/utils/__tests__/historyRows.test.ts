@@ -0,0 +1,115 @@
+import { getRowView } from '../historyRows';
+import { useTransactionStore } from '../../socket/transactionStore';
+
+const makeHistory = (count: number) =>
+  Array.from({ length: count }, (_, i) => ({
+    id: count - i,
+    type: (i % 2) + 1,
+    note: `MIMO${count - i}`,
+    status: i % 3 === 0 ? 0 : i % 3 === 1 ? 1 : 2,
+    amount_usdt: 100 + i,
+    amount_vnd_real: 2640000 + i,
+    rate: 26500,
+    fee_vnd: 7950,
+    fee_percent: 0.003,
+    created_at: '2025-09-13T10:05:00.000000Z',
+  }));
+
+describe('history rows', () => {
+  it('formats a row once per transaction object', () => {
+    const tx = makeHistory(1)[0];
+    const view = getRowView(tx);
+    expect(getRowView(tx)).toBe(view);
+    expect(view.exchangeAmount).toBe('100 USDT');
+    expect(view.fee).toBe('7.950 VND (0.30%)');
+    expect(getRowView({ ...tx })).not.toBe(view);
+  });
+
+  it('keeps status buckets in history order as events move transactions', () => {
+    const store = useTransactionStore.getState();
+    store.setAll(makeHistory(10000));
+    const { buckets } = useTransactionStore.getState();
+    expect(buckets.pending.length + buckets.success.length + buckets.fail.length).toBe(10000);
+
+    const start = performance.now();
+    const moved = buckets.pending.slice(0, 200);
+    store.applyEvents(moved.map((id) => ({ id_transaction: id, status: 1 })));
+    const ms = performance.now() - start;
+
+    const next = useTransactionStore.getState().buckets;
+    expect(next.pending.length).toBe(buckets.pending.length - 200);
+    expect(next.success.length).toBe(buckets.success.length + 200);
+    // Untouched bucket keeps its identity, so its tab does not re-render
+    expect(next.fail).toBe(buckets.fail);
+    const { position } = useTransactionStore.getState();
+    expect(next.success.every((id, i) => i === 0 || position[next.success[i - 1]] < position[id])).toBe(true);
+    console.log(`[history] 200 status moves over 10k rows: ${ms.toFixed(1)}ms`);
+  });
+
+  it('keeps unchanged records (and so their memoized rows) across a 10k-row refresh', () => {
+    const store = useTransactionStore.getState();
+    store.setAll(makeHistory(10000));
+    const before = useTransactionStore.getState().byId;
+    // Visible window: rows formatted once, cached per record object
+    const visible = useTransactionStore.getState().ids.slice(0, 20).map((id) => getRowView(before[id]));
+
+    // A sync returns fresh objects for every row; one of them changed status
+    const page = makeHistory(10000);
+    page[5] = { ...page[5], status: 1 };
+    const gc = (globalThis as any).gc as (() => void) | undefined;
+    gc?.();
+    const heapBefore = process.memoryUsage().heapUsed;
+    const start = performance.now();
+    store.merge(page);
+    const ms = performance.now() - start;
+    gc?.();
+    const heapGrowth = process.memoryUsage().heapUsed - heapBefore;
+
+    const after = useTransactionStore.getState().byId;
+    const changed = page.filter((tx) => after[tx.id] !== before[tx.id]).map((tx) => tx.id);
+    // React.memo rows compare the record by identity: only this one re-renders
+    expect(changed).toEqual([page[5].id]);
+    const rerendered = useTransactionStore.getState().ids.slice(0, 20).filter((id, i) => getRowView(after[id]) !== visible[i]);
+    expect(rerendered).toEqual([page[5].id]);
+    console.log(
+      `[history] 10k-row refresh: merge ${ms.toFixed(1)}ms, ${changed.length} row re-rendered, ` +
+        `heap ${gc ? `+${(heapGrowth / 1024).toFixed(0)}KB` : 'n/a'}`,
+    );
+  });
+
+  it('replaces records whose other fields changed in a delta merge', () => {
+    const store = useTransactionStore.getState();
+    store.setAll(makeHistory(100));
+    const before = useTransactionStore.getState().byId;
+
+    // Same status and hash, only the credited amount was corrected
+    const delta = { ...makeHistory(100)[10], amount_vnd_real: 2630000 };
+    store.merge([delta, makeHistory(100)[11]]);
+
+    const after = useTransactionStore.getState().byId;
+    expect(after[delta.id]).not.toBe(before[delta.id]);
+    expect(after[delta.id].amount_vnd_real).toBe(2630000);
+    expect(after[makeHistory(100)[11].id]).toBe(before[makeHistory(100)[11].id]);
+  });
+
+  it('replaces records whose other fields changed in a full refetch', () => {
+    const store = useTransactionStore.getState();
+    store.setAll(makeHistory(100));
+    const before = useTransactionStore.getState().byId;
+
+    const refetch = makeHistory(100);
+    refetch[3] = { ...refetch[3], fee_vnd: 8000, bank: { name: 'VCB', account: '0123' } };
+    store.setAll(refetch);
+
+    const after = useTransactionStore.getState().byId;
+    const changed = refetch.filter((tx) => after[tx.id] !== before[tx.id]).map((tx) => tx.id);
+    expect(changed).toEqual([refetch[3].id]);
+    expect(after[refetch[3].id].fee_vnd).toBe(8000);
+
+    // Nested values compare by content, so an identical refetch keeps every object
+    const again = useTransactionStore.getState().byId;
+    store.setAll(refetch.map((tx) => JSON.parse(JSON.stringify(tx))));
+    const kept = useTransactionStore.getState().byId;
+    expect(refetch.every((tx) => kept[tx.id] === again[tx.id])).toBe(true);
+  });
+});
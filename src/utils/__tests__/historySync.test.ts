@@ -0,0 +1,63 @@
+import { createHistorySync, type HistoryPage } from '../historySync';
+
+type Row = { id: number; status: number };
+
+const setup = (pages: HistoryPage<Row>[]) => {
+  const calls: Record<string, string | number>[] = [];
+  const local = new Map<number, Row>();
+  const sync = createHistorySync<Row>({
+    request: async (params) => {
+      calls.push(params);
+      return { page: pages.shift()!, bytes: 100 };
+    },
+    replace: (list) => {
+      local.clear();
+      list.forEach((r) => local.set(r.id, r));
+    },
+    merge: (list) => list.forEach((r) => local.set(r.id, r)),
+    pageSize: 2,
+  });
+  return { sync, calls, local };
+};
+
+describe('createHistorySync', () => {
+  it('pages changes after the cursor and older rows below the oldest page', async () => {
+    const { sync, calls, local } = setup([
+      { data: [{ id: 9, status: 0 }, { id: 8, status: 0 }], meta: { cursor: 'c1', has_more: true } },
+      { data: [{ id: 9, status: 1 }, { id: 10, status: 0 }], meta: { cursor: 'c2', has_more: true } },
+      { data: [{ id: 3, status: 2 }], meta: { cursor: 'c3', has_more: false } },
+      { data: [{ id: 7, status: 1 }], meta: { has_more: false } },
+    ]);
+
+    await sync.sync();
+    await sync.sync();
+    await sync.loadOlder();
+
+    expect(calls).toEqual([
+      { limit: 2 },
+      { updated_after: 'c1', limit: 2 },
+      { updated_after: 'c2', limit: 2 },
+      // Row 3 arrived as a change, not a page: paging continues below 8
+      { before_id: 8, limit: 2 },
+    ]);
+    expect(local.get(9)!.status).toBe(1);
+    expect(sync.checkpoint()).toEqual({ cursor: 'c3', oldestId: 7, complete: true });
+    expect(sync.stats().lastSyncRows).toBe(3);
+  });
+
+  it('reloads from the top on reset and treats a reply without meta as the full list', async () => {
+    const { sync, calls, local } = setup([
+      { data: [{ id: 2, status: 0 }], meta: { cursor: 'c1', has_more: false } },
+      { data: [], meta: { reset: true } },
+      { data: [{ id: 5, status: 1 }, { id: 4, status: 1 }, { id: 1, status: 1 }] },
+    ]);
+
+    await sync.sync();
+    await sync.sync();
+
+    expect(calls[1]).toEqual({ updated_after: 'c1', limit: 2 });
+    expect(calls[2]).toEqual({ limit: 2 });
+    expect(Array.from(local.keys())).toEqual([5, 4, 1]);
+    expect(sync.checkpoint()).toEqual({ cursor: null, oldestId: 1, complete: true });
+  });
+});
@@ -0,0 +1,39 @@
+import { decodeJsonSliced } from '../jsonDecoder';
+
+const makeHistory = (count: number) => ({
+  status: true,
+  message: 'data',
+  data: Array.from({ length: count }, (_, i) => ({
+    id: i + 1,
+    type: (i % 2) + 1,
+    address: `TR7NHqjeKQxCw${i}`,
+    amount_usdt: 10.5 + i,
+    amount_vnd_real: 265000 * (i + 1),
+    note: i % 7 === 0 ? 'quoted "note", with [brackets] {and} \\ slashes' : `MIMO${i}`,
+    transaction_hash: i % 3 === 0 ? null : `0x${i.toString(16)}`,
+    status: i % 5,
+    created_at: '2025-09-13T10:00:00.000000Z',
+  })),
+  meta: { total: count },
+});
+
+describe('decodeJsonSliced', () => {
+  it.each([1000, 10000, 50000])('decodes %i transactions like JSON.parse', async (count) => {
+    const text = JSON.stringify(makeHistory(count));
+    const { value, stats } = await decodeJsonSliced(text, { budgetMs: 4 });
+
+    expect(value).toEqual(JSON.parse(text));
+    expect(stats.records).toBe(count);
+    // JS-thread blocking per slice vs. one JSON.parse of the whole body
+    console.log(
+      `[decode] ${count} tx, ${(stats.bytes / 1024).toFixed(0)} KB: ` +
+        `${stats.slices} slices, max ${stats.maxSliceMs.toFixed(1)}ms, total ${stats.totalMs.toFixed(1)}ms`,
+    );
+  });
+
+  it('handles empty arrays and unexpected shapes', async () => {
+    expect((await decodeJsonSliced('{"status":true,"data":[]}')).value).toEqual({ status: true, data: [] });
+    expect((await decodeJsonSliced('{"status":false}')).value).toEqual({ status: false });
+    expect((await decodeJsonSliced('{"data":[1, "a,b", null, [2]]}')).value).toEqual({ data: [1, 'a,b', null, [2]] });
+  });
+});
@@ -0,0 +1,71 @@
+import AsyncStorage from '@react-native-async-storage/async-storage';
+import { KVStore } from '../kvStore';
+
+jest.mock('@react-native-async-storage/async-storage', () =>
+  require('@react-native-async-storage/async-storage/jest/async-storage-mock'),
+);
+
+describe('KVStore', () => {
+  it('serves hot keys synchronously after a single load', async () => {
+    await AsyncStorage.setItem('token', 'abc');
+    await AsyncStorage.setItem('user', JSON.stringify({ id: 1, email: 'test@example.com' }));
+    await KVStore.ready();
+
+    expect(KVStore.getString('token')).toBe('abc');
+    const user = KVStore.getObject('user');
+    expect(user).toEqual({ id: 1, email: 'test@example.com' });
+    // Memoized: no JSON.parse on repeated reads
+    expect(KVStore.getObject('user')).toBe(user);
+  });
+
+  it('coalesces writes and persists them in order', async () => {
+    KVStore.setString('user-language', 'en');
+    KVStore.setString('user-language', 'vi');
+    KVStore.remove('token');
+    expect(KVStore.getString('user-language')).toBe('vi');
+    expect(KVStore.getString('token')).toBeNull();
+
+    await KVStore.flushed();
+    expect(await AsyncStorage.getItem('user-language')).toBe('vi');
+    expect(await AsyncStorage.getItem('token')).toBeNull();
+  });
+
+  it('rejects flushed() when the write fails and retries the key', async () => {
+    const multiSet = AsyncStorage.multiSet;
+    (AsyncStorage as any).multiSet = async () => {
+      throw new Error('disk full');
+    };
+    KVStore.setString('token', 'fresh');
+    await expect(KVStore.flushed()).rejects.toThrow('disk full');
+    (AsyncStorage as any).multiSet = multiSet;
+    await KVStore.flushed();
+    expect(await AsyncStorage.getItem('token')).toBe('fresh');
+  });
+
+  it('benchmarks token reads and writes against AsyncStorage', async () => {
+    // The mock has no bridge or SQLite cost, so this is a lower bound on the gap
+    await KVStore.flushed();
+    const N = 20000;
+    let start = performance.now();
+    let hits = 0;
+    for (let i = 0; i < N; i++) if (KVStore.getString('token')) hits++;
+    const hot = ((performance.now() - start) * 1e6) / N;
+    start = performance.now();
+    for (let i = 0; i < N; i++) if (await AsyncStorage.getItem('token')) hits++;
+    const direct = ((performance.now() - start) * 1e6) / N;
+
+    const W = 2000;
+    start = performance.now();
+    for (let i = 0; i < W; i++) KVStore.setString('user-language', i % 2 ? 'en' : 'vi');
+    await KVStore.flushed();
+    const coalesced = ((performance.now() - start) * 1e3) / W;
+    start = performance.now();
+    for (let i = 0; i < W; i++) await AsyncStorage.setItem('user-language', i % 2 ? 'en' : 'vi');
+    const each = ((performance.now() - start) * 1e3) / W;
+    console.log(
+      `  read token: KVStore ${hot.toFixed(0)} ns, AsyncStorage.getItem ${direct.toFixed(0)} ns; ` +
+        `write: KVStore ${coalesced.toFixed(2)} µs (coalesced), setItem ${each.toFixed(2)} µs`,
+    );
+    expect(hits).toBe(2 * N);
+  });
+});
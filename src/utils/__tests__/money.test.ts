@@ -0,0 +1,181 @@
+import {
+  type AmountEntry,
+  USDT_ENTRY,
+  USDT_SCALE,
+  VND_ENTRY,
+  RATE_SCALE,
+  deleteKey,
+  divide,
+  emptyEntry,
+  entryFromText,
+  formatPercent,
+  formatUnits,
+  fromNumber,
+  parseDecimal,
+  percentOf,
+  pressKey,
+  toApiNumber,
+  usdtToVnd,
+  vndToUsdt,
+} from '../money';
+
+// Deterministic generator so a failing case can be replayed
+const random = (seed: number) => () => {
+  seed = (seed * 1103515245 + 12345) % 2147483648;
+  return seed / 2147483648;
+};
+const next = random(45);
+const int = (max: number) => Math.floor(next() * max);
+const big = (digits: number) => BigInt(Array.from({ length: 1 + int(digits) }, () => int(10)).join(''));
+
+describe('money', () => {
+  it('rounds with each mode', () => {
+    const cases: [number, number, string, number][] = [
+      [25, 10, 'down', 2], [25, 10, 'up', 3], [25, 10, 'half-up', 3], [25, 10, 'half-even', 2],
+      [35, 10, 'half-even', 4], [-25, 10, 'half-up', -3], [-25, 10, 'down', -2], [-25, 10, 'up', -3],
+      [24, 10, 'half-up', 2], [26, 10, 'half-even', 3], [30, 10, 'up', 3],
+    ];
+    cases.forEach(([n, d, mode, expected]) =>
+      expect(divide(BigInt(n), BigInt(d), mode as any)).toBe(BigInt(expected)),
+    );
+  });
+
+  it('division matches the exact quotient within one unit, on the side the mode asks', () => {
+    for (let i = 0; i < 5000; i++) {
+      const n = big(24);
+      const d = big(12) + BigInt(1);
+      const down = divide(n, d, 'down');
+      const up = divide(n, d, 'up');
+      expect(down * d <= n && n < (down + BigInt(1)) * d).toBe(true);
+      expect(up - down).toBe(n % d === BigInt(0) ? BigInt(0) : BigInt(1));
+      const half = divide(n, d, 'half-up');
+      // |n - half * d| <= d / 2
+      const diff = n - half * d;
+      expect((diff < BigInt(0) ? -diff : diff) * BigInt(2) <= d).toBe(true);
+    }
+  });
+
+  it('parses and formats decimals exactly', () => {
+    expect(parseDecimal('1,234.5678', 6)).toBe(BigInt(1234567800));
+    expect(parseDecimal('0.0000005', 6)).toBe(BigInt(1));
+    expect(parseDecimal('0.0000005', 6, 'half-even')).toBe(BigInt(0));
+    expect(parseDecimal('.5', 0)).toBe(BigInt(1));
+    expect(parseDecimal('-12.345', 2, 'down')).toBe(BigInt(-1234));
+    ['', '.', 'abc', '1.2.3', '1e5'].forEach((text) => expect(parseDecimal(text, 6)).toBe(null));
+    expect(formatUnits(BigInt(1234567800), 6, { digits: 2, group: ',' })).toBe('1,234.57');
+    expect(formatUnits(BigInt(-5), 6, { minDigits: 0 })).toBe('-0.000005');
+    expect(formatUnits(BigInt(100000000), 6, { minDigits: 0 })).toBe('100');
+    expect(fromNumber(0.1 + 0.2, 6)).toBe(BigInt(300000));
+    expect(fromNumber(26450.5, RATE_SCALE)).toBe(BigInt(26450500000));
+    expect(fromNumber(1e-7, 6)).toBe(BigInt(0));
+    expect(formatPercent(0.0035)).toBe('0.35');
+    expect(formatPercent(0.005, 2)).toBe('0.50');
+    expect(toApiNumber(BigInt(37807183), USDT_SCALE)).toBe(37.807183);
+
+    for (let i = 0; i < 5000; i++) {
+      const units = big(20) * (next() < 0.2 ? BigInt(-1) : BigInt(1));
+      const scale = int(9);
+      const text = formatUnits(units, scale, { group: next() < 0.5 ? ',' : '' });
+      expect(parseDecimal(text, scale)).toBe(units);
+    }
+  });
+
+  it('quotes VND and USDT without float error', () => {
+    const rate = fromNumber(26450, RATE_SCALE)!;
+    // 1,000,000 VND / 26,450 = 37.807183364...
+    expect(vndToUsdt(BigInt(1000000), rate, 'down')).toBe(BigInt(37807183));
+    expect(vndToUsdt(BigInt(1000000), rate, 'up')).toBe(BigInt(37807184));
+    expect(usdtToVnd(parseDecimal('100.10', USDT_SCALE)!, rate, 'down')).toBe(BigInt(2647645));
+    // 0.5% of 2,647,645 = 13,238.225
+    const fee = fromNumber(0.5, RATE_SCALE)!;
+    expect(percentOf(BigInt(2647645), fee, 'half-up')).toBe(BigInt(13238));
+    expect(percentOf(BigInt(2647645), fee, 'up')).toBe(BigInt(13239));
+    // Float: 0.1 USDT * 3 at 26450 drifts; fixed point does not
+    const dime = parseDecimal('0.1', USDT_SCALE)!;
+    expect(usdtToVnd(dime + dime + dime, rate, 'down')).toBe(BigInt(7935));
+
+    for (let i = 0; i < 3000; i++) {
+      const r = BigInt(20000 + int(10000)) * BigInt(1000000) + big(6);
+      const vnd = big(12);
+      // USDT bought with `vnd` never costs more than `vnd`; one more micro-unit would
+      const usdt = vndToUsdt(vnd, r, 'down');
+      expect(usdtToVnd(usdt, r, 'up') <= vnd).toBe(true);
+      expect(usdtToVnd(usdt + BigInt(1), r, 'down') >= vnd || usdtToVnd(usdt + BigInt(1), r, 'up') > vnd).toBe(true);
+      // VND needed for `usdt` at rate, rounded up, always buys at least `usdt`
+      const need = usdtToVnd(usdt, r, 'up');
+      expect(vndToUsdt(need, r, 'down') >= usdt).toBe(true);
+    }
+  });
+
+  it('keeps the keypad entry equal to a full reparse after every key', () => {
+    const keys = ['0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '.', 'del'];
+    const check = (entry: AmountEntry) => {
+      const { rule } = entry;
+      expect(entry.units).toBe(entry.raw ? parseDecimal(entry.raw, rule.scale)! : BigInt(0));
+      const [whole, fraction] = entry.raw.split('.');
+      const grouped = (whole || (entry.raw ? '0' : '')).replace(/\B(?=(\d{3})+(?!\d))/g, ',');
+      expect(entry.display).toBe(entry.raw ? grouped + (fraction !== undefined ? `.${fraction}` : '') : '0');
+      expect(/^(0|[1-9]\d*)?(\.\d*)?$/.test(entry.raw)).toBe(true);
+      expect((fraction ?? '').length <= rule.maxFraction).toBe(true);
+    };
+    for (const rule of [VND_ENTRY, USDT_ENTRY]) {
+      for (let run = 0; run < 400; run++) {
+        let entry = emptyEntry(rule);
+        for (let k = 0; k < 20; k++) {
+          const key = keys[int(keys.length)];
+          if (key === 'del') {
+            entry = deleteKey(entry);
+          } else {
+            const pressed = pressKey(entry, key);
+            // Delete undoes a key that changed the value or the text
+            if (pressed !== entry && !(entry.raw === '0' && key !== '.')) {
+              const undone = deleteKey(pressed);
+              expect(undone.raw === entry.raw || (entry.raw === '' && undone.raw === '0')).toBe(true);
+              expect(undone.units).toBe(entry.units);
+            }
+            entry = pressed;
+          }
+          check(entry);
+        }
+      }
+    }
+    expect(pressKey(emptyEntry(VND_ENTRY), '.').raw).toBe('');
+    expect(pressKey(emptyEntry(USDT_ENTRY), '.').display).toBe('0.');
+    expect(entryFromText(USDT_ENTRY, '500')!.display).toBe('500');
+    expect(entryFromText(VND_ENTRY, '1000000')!.display).toBe('1,000,000');
+    expect(entryFromText(USDT_ENTRY, '12.345')!.units).toBe(BigInt(12340000));
+  });
+
+  it('benchmarks a keypress against the regex + parseFloat path', () => {
+    const digits = '1234567890';
+    const legacy = (amount: string, num: string) => {
+      const clean = amount.replace(/,/g, '') + num;
+      if (!/^\d*\.?\d{0,2}$/.test(clean) || isNaN(parseFloat(clean))) return amount;
+      return clean.split('.')[0].replace(/\B(?=(\d{3})+(?!\d))/g, ',');
+    };
+    const N = 20000;
+    const time = (fn: () => void) => {
+      let ns = 0;
+      for (let pass = 0; pass < 2; pass++) {
+        const start = performance.now();
+        fn();
+        ns = ((performance.now() - start) * 1e6) / (N * digits.length);
+      }
+      return ns;
+    };
+    const old = time(() => {
+      for (let i = 0; i < N; i++) {
+        let amount = '';
+        for (const d of digits) amount = legacy(amount, d);
+      }
+    });
+    const engine = time(() => {
+      for (let i = 0; i < N; i++) {
+        let entry = emptyEntry(USDT_ENTRY);
+        for (const d of digits) entry = pressKey(entry, d);
+      }
+    });
+    console.log(`  regex + parseFloat per key ${old.toFixed(0)} ns, pressKey ${engine.toFixed(0)} ns`);
+    expect(engine > 0).toBe(true);
+  });
+});
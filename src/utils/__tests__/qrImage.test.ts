@@ -0,0 +1,125 @@
+import { inflateSync } from 'zlib';
+import { encodeQrPng, rasterizeQr, toBase64, type QrModules } from '../qrImage';
+
+// Deterministic stand-in for an encoder's matrix: finder patterns plus noise
+const matrix = (size: number, seed = 1): QrModules => {
+  const data = new Uint8Array(size * size);
+  let s = seed;
+  for (let i = 0; i < data.length; i++) {
+    s = (s * 1103515245 + 12345) & 0x7fffffff;
+    data[i] = (s >> 16) & 1;
+  }
+  for (const [r0, c0] of [[0, 0], [0, size - 7], [size - 7, 0]]) {
+    for (let r = 0; r < 7; r++) {
+      for (let c = 0; c < 7; c++) {
+        const ring = Math.max(Math.abs(r - 3), Math.abs(c - 3));
+        data[(r0 + r) * size + c0 + c] = ring === 2 ? 0 : 1;
+      }
+    }
+  }
+  return { size, data };
+};
+
+// PNG -> { side, palette, pixel(x, y) } through node's zlib
+const decode = (png: Uint8Array) => {
+  const buf = Buffer.from(png);
+  expect(buf.subarray(0, 8).toString('hex')).toBe('89504e470d0a1a0a');
+  let at = 8;
+  let side = 0;
+  let palette = Buffer.alloc(0);
+  const idat: Buffer[] = [];
+  while (at < buf.length) {
+    const length = buf.readUInt32BE(at);
+    const type = buf.toString('latin1', at + 4, at + 8);
+    const body = buf.subarray(at + 8, at + 8 + length);
+    if (type === 'IHDR') {
+      side = body.readUInt32BE(0);
+      expect([body[8], body[9]]).toEqual([1, 3]);
+    }
+    if (type === 'PLTE') palette = body;
+    if (type === 'IDAT') idat.push(body);
+    at += 12 + length;
+  }
+  const raw = inflateSync(Buffer.concat(idat));
+  const stride = 1 + Math.ceil(side / 8);
+  expect(raw.length).toBe(stride * side);
+  const pixel = (x: number, y: number) => (raw[y * stride + 1 + (x >> 3)] >> (7 - (x & 7))) & 1;
+  return { side, palette, pixel };
+};
+
+// What react-native-qrcode-svg (the previous renderer) built on every render: one path, a segment per dark run
+const svgPath = ({ size, data }: QrModules) => {
+  let d = '';
+  for (let r = 0; r < size; r++) {
+    let c = 0;
+    while (c < size) {
+      if (!data[r * size + c]) {
+        c++;
+        continue;
+      }
+      const from = c;
+      while (c < size && data[r * size + c]) c++;
+      d += `M ${from} ${r + 0.5} L ${c} ${r + 0.5} `;
+    }
+  }
+  return d;
+};
+
+describe('qr image', () => {
+  it('encodes every module at an integer scale with a quiet zone', () => {
+    for (const [size, scale, quiet] of [[21, 1, 0], [25, 3, 2], [33, 7, 4], [57, 10, 0]]) {
+      const modules = matrix(size, size);
+      const { side, palette, pixel } = decode(encodeQrPng(modules, scale, quiet, '#1A1A1A', '#fff'));
+      expect(side).toBe((size + quiet * 2) * scale);
+      expect([...palette]).toEqual([0x1a, 0x1a, 0x1a, 255, 255, 255]);
+      for (let y = 0; y < side; y++) {
+        for (let x = 0; x < side; x++) {
+          const r = Math.floor(y / scale) - quiet;
+          const c = Math.floor(x / scale) - quiet;
+          const inside = r >= 0 && r < size && c >= 0 && c < size;
+          const dark = inside && modules.data[r * size + c] === 1;
+          if (pixel(x, y) !== (dark ? 0 : 1)) throw new Error(`pixel ${x},${y} of ${size}@${scale}`);
+        }
+      }
+    }
+  });
+
+  it('fits the largest whole scale into the requested pixels', () => {
+    const raster = rasterizeQr(matrix(29), 600, 0, '#000', '#fff');
+    expect(raster.pixels).toBe(29 * 20);
+    expect(raster.uri.startsWith('data:image/png;base64,')).toBe(true);
+    const png = Buffer.from(raster.uri.split(',')[1], 'base64');
+    expect(png.length).toBe(raster.bytes);
+    for (const n of [0, 1, 2, 3, 4, 5]) {
+      const bytes = new Uint8Array(n).map((_, i) => i * 77);
+      expect(toBase64(bytes)).toBe(Buffer.from(bytes).toString('base64'));
+    }
+  });
+
+  it('benchmarks encoding against building the SVG path', () => {
+    // A TRC20 deposit address is version 2-3; a payment URI with memo about version 6
+    const rows = [25, 41, 57].map((size) => {
+      const modules = matrix(size);
+      const pixels = 200 * 3;
+      const N = 50;
+      let start = performance.now();
+      let raster = rasterizeQr(modules, pixels, 0, '#1A1A1A', '#fff');
+      for (let i = 0; i < N; i++) raster = rasterizeQr(modules, pixels, 0, '#1A1A1A', '#fff');
+      const encode = (performance.now() - start) / (N + 1);
+      start = performance.now();
+      let d = '';
+      for (let i = 0; i < N; i++) d = svgPath(modules);
+      const path = (performance.now() - start) / N;
+      return { size, encode, path, kb: raster.bytes / 1024, pathKb: d.length / 1024 };
+    });
+    console.log(
+      rows
+        .map((r) =>
+          `  ${r.size}x${r.size} @600px: PNG ${r.encode.toFixed(2)} ms once (${r.kb.toFixed(1)}KB), ` +
+          `SVG path ${r.path.toFixed(3)} ms per render (${r.pathKb.toFixed(1)}KB of path data)`,
+        )
+        .join('\n'),
+    );
+    rows.forEach((r) => expect(r.kb < 8).toBe(true));
+  });
+});
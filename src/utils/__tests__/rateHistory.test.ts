@@ -0,0 +1,97 @@
+import { createTickRing, layoutChart, lttb, segmentPath } from '../rateHistory';
+
+const T0 = Date.parse('2025-09-13T00:00:00Z');
+
+// Random walk around 26,450 with one spike, one tick per second
+const fill = (count: number, capacity = count) => {
+  const ring = createTickRing(capacity);
+  let rate = 26450;
+  for (let i = 0; i < count; i++) {
+    rate += Math.sin(i * 7.3) * 3;
+    ring.push(T0 + i * 1000, i === Math.floor(count / 3) ? 27500 : rate);
+  }
+  return ring;
+};
+
+describe('rate history', () => {
+  it('keeps the newest ticks once the ring wraps', () => {
+    const ring = createTickRing(5); // rounded up to 8
+    for (let i = 0; i < 20; i++) ring.push(i, i * 10);
+    expect(ring.start()).toBe(12);
+    expect(ring.end()).toBe(20);
+    expect(ring.value(12)).toBe(120);
+    expect(ring.value(19)).toBe(190);
+    let calls = 0;
+    const off = ring.subscribe(() => calls++);
+    ring.push(20, 200);
+    off();
+    ring.push(21, 210);
+    expect(calls).toBe(1);
+  });
+
+  it('downsamples to the threshold, keeping ends and spikes', () => {
+    const ring = fill(10000);
+    const picked = lttb(ring, 0, 10000, 300);
+    expect(picked.length).toBe(300);
+    expect(picked[0]).toBe(0);
+    expect(picked[299]).toBe(9999);
+    expect(picked.includes(3333)).toBe(true);
+    for (let i = 1; i < picked.length; i++) expect(picked[i] > picked[i - 1]).toBe(true);
+    // Fewer ticks than columns: all of them
+    expect(lttb(ring, 100, 110, 300)).toEqual([100, 101, 102, 103, 104, 105, 106, 107, 108, 109]);
+    expect(segmentPath(ring, [0, 1], T0).d.startsWith('M0 ')).toBe(true);
+  });
+
+  it('reuses the downsampled body until a bucket of ticks has arrived', () => {
+    const ring = fill(3600, 4096);
+    const first = layoutChart(ring, 360, 120, null)!;
+    expect(first.body.d.split('L').length).toBe(360);
+    // 3600 ticks over 360 columns: 10 per bucket
+    let body = first.body;
+    let rebuilds = 0;
+    for (let i = 0; i < 100; i++) {
+      ring.push(T0 + (3600 + i) * 1000, 26450);
+      const frame = layoutChart(ring, 360, 120, body)!;
+      if (frame.body !== body) rebuilds++;
+      expect(frame.tail.d.split('L').length <= 12).toBe(true);
+      body = frame.body;
+    }
+    expect(rebuilds <= 10).toBe(true);
+    expect(layoutChart(createTickRing(4), 360, 120, null)).toBe(null);
+  });
+
+  it('benchmarks per-tick chart work at 1k, 10k and 100k points', () => {
+    const WIDTH = 360;
+    const TICKS = 2000;
+    const rows = [1000, 10000, 100000].map((count) => {
+      const ring = fill(count);
+      // Before: every tick rebuilds one path through every point (plus a node per point)
+      let start = performance.now();
+      const all = Array.from({ length: count }, (_, i) => i);
+      for (let i = 0; i < 20; i++) segmentPath(ring, all, T0);
+      const full = (performance.now() - start) / 20;
+
+      // After: steady stream into a full ring, amortized over rebuilds
+      let body = layoutChart(ring, WIDTH, 120, null)!.body;
+      start = performance.now();
+      let worst = 0;
+      for (let i = 0; i < TICKS; i++) {
+        const tickStart = performance.now();
+        ring.push(T0 + (count + i) * 1000, 26450 + (i % 7));
+        body = layoutChart(ring, WIDTH, 120, body)!.body;
+        worst = Math.max(worst, performance.now() - tickStart);
+      }
+      const perTick = (performance.now() - start) / TICKS;
+      return { count, full, perTick, worst, points: body.d.split('L').length };
+    });
+    console.log(
+      rows
+        .map((r) =>
+          `  ${String(r.count).padStart(6)} pts: full path ${r.full.toFixed(2)} ms/frame, ` +
+          `pipeline ${r.perTick.toFixed(3)} ms/tick (worst ${r.worst.toFixed(2)} ms), ${r.points} drawn`,
+        )
+        .join('\n'),
+    );
+    rows.forEach((r) => expect(r.points <= WIDTH).toBe(true));
+  });
+});
@@ -0,0 +1,54 @@
+import {
+  QUOTE_MIN_REFRESH,
+  QUOTE_ORDER_MARGIN,
+  QUOTE_REFRESH_LEAD,
+  isQuoteRejection,
+  isQuoteUsable,
+  parseQuote,
+  refreshAt,
+} from '../rateQuote';
+
+const NOW = Date.parse('2025-09-13T03:05:00Z');
+
+describe('rate quotes', () => {
+  it('reads quotes in every shape the rate endpoint sends', () => {
+    expect(parseQuote({ rate: 26450, fee: 0.5, quote_id: 'q1', expires_at: '2025-09-13T03:05:30Z' }, NOW)).toEqual({
+      rate: 26450,
+      fee: 0.5,
+      quoteId: 'q1',
+      expiresAt: NOW + 30000,
+    });
+    expect(parseQuote({ quote: { id: 7, rate: '26450.5', expires_in: 20 } }, NOW)).toMatchObject({
+      rate: 26450.5,
+      quoteId: '7',
+      expiresAt: NOW + 20000,
+    });
+    expect(parseQuote({ rate: 1, quote_id: 'q', expires_at: NOW / 1000 + 10 }, NOW)!.expiresAt).toBe(NOW + 10000);
+    // Plain rate feed: no quote, no expiry
+    expect(parseQuote({ usdt_vnd_rate: 26000 }, NOW)).toEqual({ rate: 26000, fee: null, quoteId: null, expiresAt: null });
+    expect(parseQuote({ rate: 'abc' }, NOW)).toBe(null);
+    expect(parseQuote(null, NOW)).toBe(null);
+  });
+
+  it('refreshes just before expiry instead of on the fixed period', () => {
+    expect(refreshAt({ expiresAt: null }, NOW, 20000)).toBe(NOW + 20000);
+    expect(refreshAt({ expiresAt: NOW + 60000 }, NOW, 20000)).toBe(NOW + 60000 - QUOTE_REFRESH_LEAD);
+    // Already inside the lead: soon, but not in a loop
+    expect(refreshAt({ expiresAt: NOW + 500 }, NOW, 20000)).toBe(NOW + QUOTE_MIN_REFRESH);
+  });
+
+  it('only sends orders on quotes with time left', () => {
+    expect(isQuoteUsable({ quoteId: null, expiresAt: null }, NOW)).toBe(true);
+    expect(isQuoteUsable({ quoteId: 'q', expiresAt: NOW + QUOTE_ORDER_MARGIN }, NOW)).toBe(true);
+    expect(isQuoteUsable({ quoteId: 'q', expiresAt: NOW + QUOTE_ORDER_MARGIN - 1 }, NOW)).toBe(false);
+    expect(isQuoteUsable({ quoteId: 'q', expiresAt: NOW - 1 }, NOW)).toBe(false);
+  });
+
+  it('tells quote rejections from other order errors', () => {
+    expect(isQuoteRejection({ response: { status: 409, data: { code: 'quote_expired' } } })).toBe(true);
+    expect(isQuoteRejection({ response: { status: 422, data: { message: 'The quote id is invalid.' } } })).toBe(true);
+    expect(isQuoteRejection({ response: { status: 422, data: { message: 'Insufficient balance' } } })).toBe(false);
+    expect(isQuoteRejection({ response: { status: 500, data: { code: 'quote_expired' } } })).toBe(false);
+    expect(isQuoteRejection(new Error('Network Error'))).toBe(false);
+  });
+});
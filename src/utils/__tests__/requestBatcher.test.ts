@@ -0,0 +1,75 @@
+import { BATCH_ENDPOINT, createRequestBatcher } from '../requestBatcher';
+
+const routes: Record<string, { status: number; body: any }> = {
+  '/client/profile': { status: 200, body: { status: true, data: { full_name: 'Test User' } } },
+  '/client/wallet/data': { status: 200, body: { status: true, data: [] } },
+  '/client/bank/data': { status: 500, body: { status: false } },
+};
+
+// Local stand-in for the server, including the /client/batch endpoint
+const createStandIn = (options: { batch: boolean }) => {
+  const calls: string[] = [];
+  const get = jest.fn(async (url: string) => {
+    calls.push(`GET ${url}`);
+    const route = routes[url];
+    if (!route || route.status >= 400) {
+      throw { response: { status: route?.status ?? 404, data: route?.body } };
+    }
+    return { data: route.body, status: route.status };
+  });
+  const post = jest.fn(async (url: string, payload: any) => {
+    calls.push(`POST ${url}`);
+    if (url !== BATCH_ENDPOINT || !options.batch) {
+      throw { response: { status: 404 } };
+    }
+    return {
+      status: 200,
+      data: {
+        responses: payload.requests.map((r: any) => ({
+          id: r.id,
+          status: routes[r.url]?.status ?? 404,
+          body: routes[r.url]?.body,
+        })),
+      },
+    };
+  });
+  return { client: { get, post } as any, calls };
+};
+
+describe('requestBatcher', () => {
+  it('sends GETs issued in the same tick as one batch and demultiplexes', async () => {
+    const { client, calls } = createStandIn({ batch: true });
+    const items: string[] = [];
+    const batcher = createRequestBatcher(client, { onItem: (url) => items.push(url) });
+
+    const profile = batcher.get('/client/profile');
+    const wallets = batcher.get('/client/wallet/data');
+    const walletsAgain = batcher.get('/client/wallet/data');
+    const banks = batcher.get('/client/bank/data');
+
+    await expect(profile).resolves.toMatchObject({ data: { data: { full_name: 'Test User' } } });
+    await expect(wallets).resolves.toMatchObject({ status: 200 });
+    await expect(walletsAgain).resolves.toMatchObject({ status: 200 });
+    await expect(banks).rejects.toMatchObject({ response: { status: 500 } });
+    // The failed item is re-issued through the client (auth handling, retries, metrics)
+    expect(calls).toEqual([`POST ${BATCH_ENDPOINT}`, 'GET /client/bank/data']);
+    expect(items).toEqual(['/client/profile', '/client/wallet/data']);
+  });
+
+  it('falls back to individual calls when the batch endpoint is missing', async () => {
+    const { client, calls } = createStandIn({ batch: false });
+    const batcher = createRequestBatcher(client);
+
+    await Promise.all([batcher.get('/client/profile'), batcher.get('/client/wallet/data')]);
+    expect(calls).toEqual([
+      `POST ${BATCH_ENDPOINT}`,
+      'GET /client/profile',
+      'GET /client/wallet/data',
+    ]);
+
+    // Batching stays off for the rest of the session
+    calls.length = 0;
+    await Promise.all([batcher.get('/client/profile'), batcher.get('/client/wallet/data')]);
+    expect(calls).toEqual(['GET /client/profile', 'GET /client/wallet/data']);
+  });
+});
@@ -0,0 +1,57 @@
+import {
+  CircuitBreaker,
+  computeBackoff,
+  getHost,
+  getRetryPolicy,
+  isRetryableError,
+} from '../retryPolicy';
+
+describe('retryPolicy', () => {
+  it('does not retry plain mutations or auth failures', () => {
+    const post = getRetryPolicy('post', '/client/wallet/create');
+    expect(isRetryableError({ message: 'Network Error' }, post, 0)).toBe(false);
+
+    const get = getRetryPolicy('get', '/client/profile');
+    expect(isRetryableError({ response: { status: 401 } }, get, 0)).toBe(false);
+    expect(isRetryableError({ response: { status: 503 } }, get, 0)).toBe(true);
+    expect(isRetryableError({ response: { status: 503 } }, get, get.maxRetries)).toBe(false);
+  });
+
+  it('keeps full-jitter backoff within the exponential ceiling', () => {
+    expect(computeBackoff(1, () => 0)).toBe(0);
+    expect(computeBackoff(1, () => 0.999)).toBeLessThan(1000);
+    expect(computeBackoff(10, () => 0.999)).toBeLessThan(10000);
+  });
+
+  it('opens the breaker per host and lets a single probe through', () => {
+    let now = 0;
+    const breaker = new CircuitBreaker(2, 1000, () => now);
+    breaker.recordFailure('a');
+    breaker.recordFailure('a');
+    expect(breaker.canRequest('a')).toBe(false);
+    expect(breaker.canRequest('b')).toBe(true);
+
+    now = 1500;
+    expect(breaker.canRequest('a')).toBe(true);
+    expect(breaker.canRequest('a')).toBe(false);
+    breaker.recordSuccess('a');
+    expect(breaker.canRequest('a')).toBe(true);
+  });
+
+  it('lets the next request probe when the probe is cancelled', () => {
+    let now = 0;
+    const breaker = new CircuitBreaker(1, 1000, () => now);
+    breaker.recordFailure('a');
+    now = 1500;
+    expect(breaker.canRequest('a')).toBe(true);
+    breaker.releaseProbe('a');
+    expect(breaker.isOpen('a')).toBe(true);
+    expect(breaker.canRequest('a')).toBe(true);
+    expect(breaker.canRequest('a')).toBe(false);
+  });
+
+  it('extracts the host from base and absolute URLs', () => {
+    expect(getHost('https://mimo.dragonlab.vn/api', '/client/profile')).toBe('mimo.dragonlab.vn');
+    expect(getHost('https://mimo.dragonlab.vn/api', 'http://localhost:8000/x')).toBe('localhost:8000');
+  });
+});
@@ -0,0 +1,89 @@
+import { createSearchIndex, foldText, queryTokens } from '../searchIndex';
+import { transactionTerms } from '../../socket/transactionSearch';
+
+const BANKS = ['Vietcombank', 'Ngân hàng Đông Á', 'Techcombank', 'BIDV'];
+
+const makeTransaction = (id: number) => ({
+  id,
+  note: `MIMO${String(id).padStart(6, '0')}`,
+  transaction_hash: (id * 2654435761).toString(16).padEnd(64, 'a'),
+  bank_name: id % 2 ? null : BANKS[(id / 2) % BANKS.length],
+  bank_account: id % 2 ? null : `0${100000000 + id}`,
+  amount_usdt: 100 + (id % 900) + 0.5,
+  amount_vnd: 2650000 + id * 1000,
+  amount_vnd_real: 2640000 + id * 1000,
+});
+
+describe('searchIndex', () => {
+  it('folds Vietnamese diacritics and grouped amounts', () => {
+    expect(foldText('Ngân hàng Đông Á')).toBe('ngan hang dong a');
+    expect(queryTokens('2.640.000 dong')).toEqual(['2640000', 'dong']);
+    expect(queryTokens('100,5')).toEqual(['100.5']);
+  });
+
+  it('matches every word by prefix and follows updates', () => {
+    const index = createSearchIndex();
+    [2, 4, 7].forEach((id) => index.set(id, transactionTerms(makeTransaction(id))));
+
+    expect(Array.from(index.search(queryTokens('dong a')))).toEqual([2]);
+    expect(Array.from(index.search(queryTokens('mimo00000')))).toEqual([2, 4, 7]);
+    expect(Array.from(index.search(queryTokens('MIMO000007')))).toEqual([7]);
+    expect(index.search(queryTokens('vietcombank dong')).size).toBe(0);
+
+    index.set(4, transactionTerms({ ...makeTransaction(4), bank_name: 'Đông Á' }), transactionTerms(makeTransaction(4)));
+    expect(Array.from(index.search(queryTokens('đông')))).toEqual([2, 4]);
+    expect(index.search(queryTokens('techcombank')).size).toBe(0);
+    index.remove(2, transactionTerms(makeTransaction(2)));
+    expect(Array.from(index.search(queryTokens('dong')))).toEqual([4]);
+  });
+
+  it('keeps the term list sorted as documents arrive after the first query', () => {
+    const index = createSearchIndex();
+    for (let id = 1; id <= 20000; id++) index.set(id, transactionTerms(makeTransaction(id)));
+    index.search(queryTokens('warm'));
+
+    // Socket/sync merges: new rows, an edited row, a removed row
+    let worst = 0;
+    for (let id = 20001; id <= 20200; id++) {
+      index.set(id, transactionTerms(makeTransaction(id)));
+      const start = performance.now();
+      expect(index.search(queryTokens(`mimo0${id}`)).has(id)).toBe(true);
+      worst = Math.max(worst, performance.now() - start);
+    }
+    index.set(7, transactionTerms({ ...makeTransaction(7), bank_name: 'Sacombank' }), transactionTerms(makeTransaction(7)));
+    expect(Array.from(index.search(queryTokens('sacom')))).toEqual([7]);
+    index.remove(20200, transactionTerms(makeTransaction(20200)));
+    expect(index.search(queryTokens('mimo020200')).size).toBe(0);
+    console.log(`[search] keystroke after an insert into 20k docs: worst ${(worst * 1000).toFixed(0)}us`);
+  });
+
+  it('benchmarks build, query latency and size at 50k transactions', () => {
+    const gc = (globalThis as any).gc;
+    const rows = Array.from({ length: 50000 }, (_, i) => transactionTerms(makeTransaction(i + 1)));
+    gc?.();
+    const heapBefore = process.memoryUsage().heapUsed;
+    const index = createSearchIndex();
+    const buildStart = performance.now();
+    rows.forEach((terms, i) => index.set(i + 1, terms));
+    const buildMs = performance.now() - buildStart;
+
+    const queries = ['mimo0421', 'vietcomb', '2690', 'dong a 01000000', 'a1b2', (123 * 2654435761).toString(16).slice(0, 10)];
+    index.search(queryTokens('warm'));
+    const timings = queries.map((q) => {
+      const start = performance.now();
+      const hits = index.search(queryTokens(q)).size;
+      return `${q}: ${hits} hits ${((performance.now() - start) * 1000).toFixed(0)}us`;
+    });
+    gc?.();
+    // Term strings are shared with the fixture, so this is the index structure itself
+    const heapMB = (process.memoryUsage().heapUsed - heapBefore) / 1024 / 1024;
+    const { documents, terms, postings } = index.size();
+
+    expect(documents).toBe(50000);
+    expect(index.search(queryTokens('MIMO050000')).has(50000)).toBe(true);
+    console.log(
+      `[search] 50k docs: build ${buildMs.toFixed(0)}ms, ${terms} terms, ${postings} postings, ~${heapMB.toFixed(1)}MB heap\n  ` +
+        timings.join('\n  '),
+    );
+  });
+});
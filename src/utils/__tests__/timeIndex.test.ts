@@ -0,0 +1,43 @@
+import { buildTimeIndex, dayRange, idsInRange, monthRange, parseTimestamp } from '../timeIndex';
+
+const HOUR = 3600 * 1000;
+const start = new Date(2024, 0, 1).getTime();
+
+// 10,000 rows, one per hour, newest first like the history endpoint
+const rows = Array.from({ length: 10000 }, (_, i) => {
+  const id = 10000 - i;
+  return { id, created_at: new Date(start + id * HOUR).toISOString().replace('Z', '000Z') };
+});
+const timeOf = (id: number) => parseTimestamp(rows[10000 - id].created_at);
+
+describe('timeIndex', () => {
+  it('parses microsecond and space separated timestamps', () => {
+    expect(parseTimestamp('2025-09-13T10:05:00.123456Z')).toBe(Date.UTC(2025, 8, 13, 10, 5, 0, 123));
+    expect(parseTimestamp('2025-09-13 10:05:00')).toBe(new Date(2025, 8, 13, 10, 5).getTime());
+    expect(isNaN(parseTimestamp(null))).toBe(true);
+  });
+
+  it('answers month and day ranges like a full scan, without one', () => {
+    const index = buildTimeIndex(rows.map((r) => r.id), timeOf);
+    expect(index.ids.length).toBe(10000);
+
+    for (const range of [monthRange(3, 2024), dayRange('2024-06-10', '2024-06-12'), monthRange(1, 2030)]) {
+      const scan = rows
+        .filter((r) => timeOf(r.id) >= range.from && timeOf(r.id) < range.to)
+        .map((r) => r.id)
+        .reverse();
+      expect(idsInRange(index, range)).toEqual(scan);
+    }
+
+    const range = monthRange(3, 2024);
+    const t0 = performance.now();
+    for (let i = 0; i < 1000; i++) idsInRange(index, range);
+    console.log(`[timeIndex] month range over 10k rows: ${(performance.now() - t0).toFixed(1)}us per query`);
+  });
+
+  it('sorts out-of-order input', () => {
+    const index = buildTimeIndex([3, 1, 2], (id) => [0, 30, 10, 20][id]);
+    expect(index.ids).toEqual([2, 3, 1]);
+    expect(index.at).toEqual([10, 20, 30]);
+  });
+});
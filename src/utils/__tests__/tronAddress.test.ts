@@ -0,0 +1,97 @@
+import { createHash, randomBytes } from 'crypto';
+import { checkTronAddress, isTronAddress } from '../tronAddress';
+
+const ALPHABET = '123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz';
+const sha256 = (data: Buffer) => createHash('sha256').update(data).digest();
+
+// Reference Base58Check with BigInt and node's SHA-256
+const encode = (payload: Buffer) => {
+  const full = Buffer.concat([payload, sha256(sha256(payload)).subarray(0, 4)]);
+  let n = BigInt(`0x${full.toString('hex')}`);
+  let out = '';
+  while (n > BigInt(0)) {
+    out = ALPHABET[Number(n % BigInt(58))] + out;
+    n /= BigInt(58);
+  }
+  return out;
+};
+
+const decodeReference = (text: string) => {
+  if (!/^T[1-9A-HJ-NP-Za-km-z]{33}$/.test(text)) return false;
+  let n = BigInt(0);
+  for (const ch of text) n = n * BigInt(58) + BigInt(ALPHABET.indexOf(ch));
+  const full = Buffer.from(n.toString(16).padStart(50, '0'), 'hex');
+  if (full.length !== 25 || full[0] !== 0x41) return false;
+  return sha256(sha256(full.subarray(0, 21))).subarray(0, 4).equals(full.subarray(21));
+};
+
+const account = () => Buffer.concat([Buffer.from([0x41]), randomBytes(20)]);
+
+describe('tron address', () => {
+  it('accepts real addresses in both forms', () => {
+    // USDT contract and the zero address
+    expect(checkTronAddress('TR7NHqjeKQxGTCi8q8ZY4pL8otSzgjLj6t')).toBe('valid');
+    expect(checkTronAddress('T9yD14Nj9j7xAB4dbGeiX9h8unkKHxuWwb')).toBe('valid');
+    expect(checkTronAddress('41a614f803b6fd780986a42c78ec9c7f77e6ded13c')).toBe('valid');
+    expect(checkTronAddress('0x41A614F803B6FD780986A42C78EC9C7F77E6DED13C')).toBe('valid');
+    expect(checkTronAddress('  TR7NHqjeKQxGTCi8q8ZY4pL8otSzgjLj6t ')).toBe('valid');
+  });
+
+  it('reports partial input while typing', () => {
+    expect(checkTronAddress('')).toBe('empty');
+    expect(checkTronAddress('T')).toBe('incomplete');
+    expect(checkTronAddress('TR7NHqjeKQ')).toBe('incomplete');
+    expect(checkTronAddress('TR7NHqjeKQ0')).toBe('invalid-char'); // 0 is not base58
+    expect(checkTronAddress('0x0x')).toBe('invalid-char');
+    expect(checkTronAddress('0x')).toBe('incomplete');
+    expect(checkTronAddress('0x42')).toBe('invalid');
+    expect(checkTronAddress('41a6')).toBe('incomplete');
+    expect(checkTronAddress('0x71C7656EC7ab88b098defB751B7401B5f6d8976F')).toBe('invalid'); // Ethereum
+    expect(checkTronAddress('bc1qar0srrr7xfkvy5l643lydnw9re59gtzzwf5mdq')).toBe('invalid-char');
+    expect(checkTronAddress('TR7NHqjeKQxGTCi8q8ZY4pL8otSzgjLj6tt')).toBe('invalid');
+  });
+
+  it('agrees with a BigInt + node crypto reference', () => {
+    for (let i = 0; i < 2000; i++) {
+      const address = encode(account());
+      expect(isTronAddress(address)).toBe(true);
+      // One changed character breaks the checksum (or the prefix)
+      const at = 1 + (i % 33);
+      const swapped = ALPHABET[(ALPHABET.indexOf(address[at]) + 1 + (i % 57)) % 58];
+      const typo = address.slice(0, at) + swapped + address.slice(at + 1);
+      expect(isTronAddress(typo)).toBe(decodeReference(typo));
+      expect(isTronAddress(typo)).toBe(false);
+    }
+    // Wrong version byte with a correct checksum
+    const wrongPrefix = encode(Buffer.concat([Buffer.from([0x42]), randomBytes(20)]));
+    expect(checkTronAddress(wrongPrefix)).toBe(wrongPrefix.startsWith('T') ? 'invalid' : 'invalid-char');
+  });
+
+  it('benchmarks a keystroke check against the reference', () => {
+    const addresses = Array.from({ length: 1000 }, () => encode(account()));
+    const N = 50;
+    const time = (fn: (text: string) => boolean) => {
+      let ns = 0;
+      for (let pass = 0; pass < 2; pass++) {
+        const start = performance.now();
+        for (let r = 0; r < N; r++) for (const address of addresses) fn(address);
+        ns = ((performance.now() - start) * 1e6) / (N * addresses.length);
+      }
+      return ns;
+    };
+    const fast = time(isTronAddress);
+    const reference = time(decodeReference);
+    // Steady-state allocation: heap after 100k checks of one address
+    const gc = (globalThis as any).gc as (() => void) | undefined;
+    gc?.();
+    const heapBefore = process.memoryUsage().heapUsed;
+    let valid = 0;
+    for (let i = 0; i < 100000; i++) if (isTronAddress(addresses[0])) valid++;
+    const heapGrowth = process.memoryUsage().heapUsed - heapBefore;
+    console.log(
+      `  isTronAddress ${fast.toFixed(0)} ns/check, BigInt + node crypto ${reference.toFixed(0)} ns/check; ` +
+        `heap +${(heapGrowth / 1024).toFixed(0)}KB over ${valid} checks`,
+    );
+    expect(fast > 0).toBe(true);
+  });
+});
@@ -0,0 +1,167 @@
+// Per-endpoint latency and payload metrics recorded by the Api interceptors.
+// Each route template keeps one fixed-size log-linear histogram per phase
+// (HDR-style: exact below 16µs, then 8 sub-buckets per power of two up to ~67s),
+// so recording is an index computation plus an increment with no allocation.
+
+export type Phase = 'queue' | 'token' | 'network' | 'parse' | 'total';
+
+export const PHASES: Phase[] = ['queue', 'token', 'network', 'parse', 'total'];
+
+const SUB_BUCKETS = 8;
+const LINEAR_LIMIT = 16;
+const MAX_EXPONENT = 26; // 2^26 µs ≈ 67s
+const BUCKET_COUNT = LINEAR_LIMIT + (MAX_EXPONENT - 3) * SUB_BUCKETS;
+
+const bucketIndex = (us: number) => {
+  const v = us < 0 ? 0 : Math.floor(us);
+  if (v < LINEAR_LIMIT) return v;
+  if (v >= 2 ** (MAX_EXPONENT + 1)) return BUCKET_COUNT - 1;
+  const e = 31 - Math.clz32(v);
+  return LINEAR_LIMIT + (e - 4) * SUB_BUCKETS + ((v >> (e - 3)) & (SUB_BUCKETS - 1));
+};
+
+// Midpoint of a bucket, in µs
+const bucketValue = (index: number) => {
+  if (index < LINEAR_LIMIT) return index;
+  const e = 4 + Math.floor((index - LINEAR_LIMIT) / SUB_BUCKETS);
+  const mantissa = (index - LINEAR_LIMIT) % SUB_BUCKETS;
+  const width = 2 ** (e - 3);
+  return (SUB_BUCKETS + mantissa) * width + width / 2;
+};
+
+export class Histogram {
+  private counts = new Uint32Array(BUCKET_COUNT);
+  count = 0;
+  max = 0;
+  sum = 0;
+
+  record(us: number) {
+    this.counts[bucketIndex(us)]++;
+    this.count++;
+    this.sum += us;
+    if (us > this.max) this.max = us;
+  }
+
+  percentile(p: number) {
+    if (this.count === 0) return 0;
+    const target = Math.max(1, Math.ceil((p / 100) * this.count));
+    let seen = 0;
+    for (let i = 0; i < BUCKET_COUNT; i++) {
+      seen += this.counts[i];
+      if (seen >= target) return Math.min(bucketValue(i), this.max);
+    }
+    return this.max;
+  }
+}
+
+type RouteStats = {
+  count: number;
+  errors: number;
+  retries: number;
+  bytesIn: number;
+  bytesOut: number;
+  phases: Record<Phase, Histogram>;
+};
+
+export interface RouteSnapshot {
+  route: string;
+  count: number;
+  errors: number;
+  retries: number;
+  bytesIn: number;
+  bytesOut: number;
+  // Milliseconds
+  phases: Record<Phase, { p50: number; p99: number; max: number; mean: number }>;
+}
+
+// Timestamps (ms, performance.now) carried on the request config
+export interface RequestTiming {
+  start: number;
+  interceptorStart?: number;
+  tokenDone?: number;
+  sent?: number;
+  received?: number;
+  parsed?: number;
+}
+
+const routes = new Map<string, RouteStats>();
+
+export const now = () => (typeof performance !== 'undefined' ? performance.now() : Date.now());
+
+// '/client/transaction-pending/123?x=1' -> 'GET /client/transaction-pending/:id'
+export const routeTemplate = (method: string | undefined, url: string | undefined) => {
+  const path = (url || '').replace(/^https?:\/\/[^/]+/, '').split('?')[0];
+  const template = path.replace(/\/(\d+|[0-9a-fA-F-]{16,}|T[1-9A-HJ-NP-Za-km-z]{33})(?=\/|$)/g, '/:id');
+  return `${(method || 'get').toUpperCase()} ${template}`;
+};
+
+const getRoute = (route: string) => {
+  let stats = routes.get(route);
+  if (!stats) {
+    stats = {
+      count: 0,
+      errors: 0,
+      retries: 0,
+      bytesIn: 0,
+      bytesOut: 0,
+      phases: {
+        queue: new Histogram(),
+        token: new Histogram(),
+        network: new Histogram(),
+        parse: new Histogram(),
+        total: new Histogram(),
+      },
+    };
+    routes.set(route, stats);
+  }
+  return stats;
+};
+
+const recordPhase = (stats: RouteStats, phase: Phase, from?: number, to?: number) => {
+  if (from != null && to != null) stats.phases[phase].record((to - from) * 1000);
+};
+
+export const ApiMetrics = {
+  record(route: string, timing: RequestTiming, bytesIn: number, bytesOut: number, failed: boolean) {
+    const stats = getRoute(route);
+    const end = timing.parsed ?? timing.received ?? now();
+    stats.count++;
+    if (failed) stats.errors++;
+    stats.bytesIn += bytesIn;
+    stats.bytesOut += bytesOut;
+    recordPhase(stats, 'queue', timing.start, timing.interceptorStart);
+    recordPhase(stats, 'token', timing.interceptorStart, timing.tokenDone);
+    recordPhase(stats, 'network', timing.sent, timing.received);
+    recordPhase(stats, 'parse', timing.received, timing.parsed);
+    recordPhase(stats, 'total', timing.start, end);
+  },
+
+  recordRetry(route: string) {
+    getRoute(route).retries++;
+  },
+
+  snapshot(): RouteSnapshot[] {
+    const result: RouteSnapshot[] = [];
+    routes.forEach((stats, route) => {
+      const phases = {} as RouteSnapshot['phases'];
+      for (const phase of PHASES) {
+        const h = stats.phases[phase];
+        phases[phase] = {
+          p50: h.percentile(50) / 1000,
+          p99: h.percentile(99) / 1000,
+          max: h.max / 1000,
+          mean: h.count ? h.sum / h.count / 1000 : 0,
+        };
+      }
+      const { count, errors, retries, bytesIn, bytesOut } = stats;
+      result.push({ route, count, errors, retries, bytesIn, bytesOut, phases });
+    });
+    return result.sort((a, b) => b.count - a.count);
+  },
+
+  reset() {
+    routes.clear();
+  },
+};
+
+export default ApiMetrics;
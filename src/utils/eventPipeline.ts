@@ -0,0 +1,70 @@
+// Coalesces bursts of socket messages into one flush per animation frame.
+// Messages with the same key replace each other inside a frame (last one wins,
+// position of the first is kept), so a settlement burst of N events for K
+// transactions costs K items and one store update instead of N renders.
+
+export interface PipelineStats {
+  received: number;
+  deduped: number;
+  flushes: number;
+  maxBatch: number;
+}
+
+export interface EventPipelineOptions<T> {
+  // Dedupe key; messages without one are never merged
+  keyOf: (message: T) => string | number | null | undefined;
+  flush: (batch: T[]) => void;
+  // Defaults to requestAnimationFrame, falling back to a 16ms timer
+  schedule?: (callback: () => void) => void;
+}
+
+const defaultSchedule = (callback: () => void) => {
+  if (typeof requestAnimationFrame === 'function') {
+    requestAnimationFrame(() => callback());
+  } else {
+    setTimeout(callback, 16);
+  }
+};
+
+export const createEventPipeline = <T>({ keyOf, flush, schedule = defaultSchedule }: EventPipelineOptions<T>) => {
+  let pending = new Map<string | number, T>();
+  let unkeyed = 0;
+  let scheduled = false;
+  const stats: PipelineStats = { received: 0, deduped: 0, flushes: 0, maxBatch: 0 };
+
+  const run = () => {
+    scheduled = false;
+    if (pending.size === 0) return;
+    const batch = Array.from(pending.values());
+    pending = new Map();
+    stats.flushes++;
+    if (batch.length > stats.maxBatch) stats.maxBatch = batch.length;
+    try {
+      flush(batch);
+    } catch (error) {
+      console.log('Event pipeline flush error:', error);
+    }
+  };
+
+  return {
+    enqueue(message: T) {
+      stats.received++;
+      const key = keyOf(message) ?? `#${unkeyed++}`;
+      if (pending.has(key)) {
+        stats.deduped++;
+      }
+      pending.set(key, message);
+      if (!scheduled) {
+        scheduled = true;
+        schedule(run);
+      }
+    },
+
+    // Flush now (e.g. before the app goes to background)
+    drain() {
+      run();
+    },
+
+    stats: () => ({ ...stats }),
+  };
+};
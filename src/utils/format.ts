@@ -0,0 +1,89 @@
+import { groupDigits } from './money';
+import { parseTimestamp } from './timeIndex';
+
+// Shared number/date formatting. `toLocaleString` and `new Intl.*Format` build a new
+// ICU formatter on every call under Hermes; here each locale + option set is built
+// once and reused. Integer VND and short USDT amounts skip ICU entirely.
+
+type NumberOptions = Intl.NumberFormatOptions;
+type DateOptions = Intl.DateTimeFormatOptions;
+
+const numberFormats = new Map<string, Intl.NumberFormat>();
+const dateFormats = new Map<string, Intl.DateTimeFormat>();
+
+const cacheKey = (locale: string | undefined, options?: object) =>
+  `${locale ?? ''}|${options ? JSON.stringify(options) : ''}`;
+
+export const numberFormat = (locale: string | undefined = 'vi-VN', options?: NumberOptions) => {
+  const key = cacheKey(locale, options);
+  let format = numberFormats.get(key);
+  if (!format) {
+    format = new Intl.NumberFormat(locale, options);
+    numberFormats.set(key, format);
+  }
+  return format;
+};
+
+export const dateTimeFormat = (locale: string | undefined = 'vi-VN', options?: DateOptions) => {
+  const key = cacheKey(locale, options);
+  let format = dateFormats.get(key);
+  if (!format) {
+    format = new Intl.DateTimeFormat(locale, options);
+    dateFormats.set(key, format);
+  }
+  return format;
+};
+
+const toNumber = (value: number | string | null | undefined) =>
+  typeof value === 'string' ? parseFloat(value) : Number(value ?? NaN);
+
+// Same output as value.toLocaleString('vi-VN'): "2.640.000", "26.450,5"
+export const formatVND = (value: number | string | null | undefined) => {
+  const num = toNumber(value);
+  if (Number.isSafeInteger(num)) {
+    return num < 0 ? `-${groupDigits(String(-num), '.')}` : groupDigits(String(num), '.');
+  }
+  return numberFormat('vi-VN').format(num);
+};
+
+// Fixed scale, en-US grouping: 1234.5 -> "1,234.50" (as toLocaleString('en-US') with
+// min = max fraction digits). Values that already fit the scale are padded without ICU;
+// anything that needs rounding goes through Intl so halves round the same way.
+export const formatUSDT = (value: number | string | null | undefined, scale = 2) => {
+  const num = toNumber(value);
+  const plain = String(num);
+  const match = /^(-?)(\d+)(?:\.(\d+))?$/.exec(plain);
+  if (match && (match[3]?.length ?? 0) <= scale && match[2].length <= 15) {
+    const fraction = (match[3] ?? '').padEnd(scale, '0');
+    return `${match[1]}${groupDigits(match[2], ',')}${scale ? `.${fraction}` : ''}`;
+  }
+  return numberFormat('en-US', { minimumFractionDigits: scale, maximumFractionDigits: scale }).format(num);
+};
+
+// Shown for a missing or unparseable timestamp instead of inventing a date
+export const DATE_PLACEHOLDER = '—';
+
+type DateInput = string | number | Date | null | undefined;
+
+const toDate = (value: DateInput) => {
+  if (value instanceof Date) return isNaN(value.getTime()) ? null : value;
+  if (value == null || value === '') return null;
+  const time = typeof value === 'number' ? value : parseTimestamp(value);
+  return isNaN(time) ? null : new Date(time);
+};
+
+// Hot paths resolve their formatter once instead of hashing options per call
+const dayFormat = dateTimeFormat('vi-VN');
+const clockFormat = dateTimeFormat('vi-VN', { hour: '2-digit', minute: '2-digit', hour12: false });
+
+// "13/9/2025", as toLocaleDateString('vi-VN')
+export const formatDate = (value: DateInput) => {
+  const date = toDate(value);
+  return date ? dayFormat.format(date) : DATE_PLACEHOLDER;
+};
+
+// "10:05", 24h
+export const formatTime = (value: DateInput) => {
+  const date = toDate(value);
+  return date ? clockFormat.format(date) : DATE_PLACEHOLDER;
+};
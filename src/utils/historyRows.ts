@@ -0,0 +1,43 @@
+import { formatDate, formatTime, formatVND } from './format';
+import { formatPercent } from './money';
+
+// Display strings for a history row, computed once per transaction object.
+// The store replaces a record only when it changes, so a WeakMap keyed by the
+// record is a cache that invalidates itself and never outlives the list.
+
+export type HistoryRowView = {
+  date: string;
+  time: string;
+  amount: string;
+  exchangeAmount: string;
+  rate: string;
+  fee: string;
+};
+
+const cache = new WeakMap<object, HistoryRowView>();
+
+const formatNumber = (n?: number | null) => (n ? formatVND(n) : '0');
+
+export const getRowView = (tx: {
+  created_at?: string;
+  amount_usdt?: number;
+  amount_vnd_real?: number;
+  rate?: number;
+  fee_vnd?: number;
+  fee_percent?: number;
+}): HistoryRowView => {
+  let view = cache.get(tx);
+  if (view) return view;
+
+  // Missing or unparseable created_at shows a placeholder, not a made-up date
+  view = {
+    date: formatDate(tx.created_at),
+    time: formatTime(tx.created_at),
+    amount: `${tx.amount_vnd_real != null ? formatVND(tx.amount_vnd_real) : '0'} VND`,
+    exchangeAmount: `${tx.amount_usdt} USDT`,
+    rate: `${formatNumber(tx.rate)} VND/USDT`,
+    fee: `${formatNumber(tx.fee_vnd)} VND (${tx.fee_percent ? formatPercent(tx.fee_percent, 2) : '0'}%)`,
+  };
+  cache.set(tx, view);
+  return view;
+};
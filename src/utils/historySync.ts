@@ -0,0 +1,184 @@
+// Incremental sync for an append-mostly list (transaction history).
+//
+// The server hands back an opaque change cursor with every page. A focus sync only
+// asks for rows changed after that cursor; older rows are paged in with `before_id`
+// as the list is scrolled. A server that ignores the parameters (no `meta` in the
+// reply) is treated as returning the full list, so the old endpoint keeps working.
+
+export type HistoryPageMeta = {
+  cursor?: string | null;
+  has_more?: boolean;
+  // Cursor is older than the server's change log: drop local state and start over
+  reset?: boolean;
+};
+
+export type HistoryPage<T> = {
+  data: T[];
+  meta?: HistoryPageMeta;
+};
+
+export type HistoryCheckpoint = {
+  cursor: string | null;
+  // Lowest id synced so far; older pages start below it
+  oldestId: number | null;
+  // Every page down to the first transaction has been loaded
+  complete: boolean;
+};
+
+export type HistorySyncStats = {
+  syncs: number;
+  fullLoads: number;
+  pages: number;
+  rows: number;
+  bytes: number;
+  lastSyncBytes: number;
+  lastSyncRows: number;
+};
+
+export interface HistorySyncOptions<T extends { id: number }> {
+  request: (params: Record<string, string | number>) => Promise<{ page: HistoryPage<T>; bytes: number }>;
+  // Full snapshot: replaces whatever is held locally
+  replace: (list: T[]) => void;
+  // Changed or older rows, upserted by id
+  merge: (list: T[]) => void;
+  pageSize?: number;
+  // Upper bound on delta pages per sync before falling back to a full reload
+  maxDeltaPages?: number;
+  onCheckpoint?: (checkpoint: HistoryCheckpoint) => void;
+}
+
+export const emptyCheckpoint = (): HistoryCheckpoint => ({ cursor: null, oldestId: null, complete: false });
+
+export const createHistorySync = <T extends { id: number }>({
+  request,
+  replace,
+  merge,
+  pageSize = 50,
+  maxDeltaPages = 20,
+  onCheckpoint,
+}: HistorySyncOptions<T>) => {
+  let checkpoint = emptyCheckpoint();
+  let syncing: Promise<void> | null = null;
+  let loadingOlder: Promise<void> | null = null;
+  const stats: HistorySyncStats = {
+    syncs: 0,
+    fullLoads: 0,
+    pages: 0,
+    rows: 0,
+    bytes: 0,
+    lastSyncBytes: 0,
+    lastSyncRows: 0,
+  };
+
+  const save = (next: HistoryCheckpoint) => {
+    checkpoint = next;
+    onCheckpoint?.(checkpoint);
+  };
+
+  // `lastSync*` covers sync() only; scrolling pages count toward the totals
+  const fetchPage = async (params: Record<string, string | number>, partOfSync = true) => {
+    const { page, bytes } = await request(params);
+    const data = page.data || [];
+    stats.pages++;
+    stats.rows += data.length;
+    stats.bytes += bytes;
+    if (partOfSync) {
+      stats.lastSyncRows += data.length;
+      stats.lastSyncBytes += bytes;
+    }
+    return { data, meta: page.meta };
+  };
+
+  const lowestId = (list: T[], current: number | null) =>
+    list.reduce((min, tx) => (min == null || tx.id < min ? tx.id : min), current);
+
+  const loadFirstPage = async () => {
+    stats.fullLoads++;
+    const { data, meta } = await fetchPage({ limit: pageSize });
+    replace(data);
+    save({
+      cursor: meta?.cursor ?? null,
+      oldestId: lowestId(data, null),
+      // Legacy reply: the full list came back in one go
+      complete: !meta || !meta.has_more,
+    });
+  };
+
+  const loadChanges = async () => {
+    let cursor = checkpoint.cursor!;
+    for (let i = 0; i < maxDeltaPages; i++) {
+      const { data, meta } = await fetchPage({ updated_after: cursor, limit: pageSize });
+      if (!meta) {
+        // Server stopped honouring cursors; treat the reply as a snapshot
+        replace(data);
+        save({ cursor: null, oldestId: lowestId(data, null), complete: true });
+        return;
+      }
+      if (meta.reset) {
+        await loadFirstPage();
+        return;
+      }
+      if (data.length) merge(data);
+      cursor = meta.cursor ?? cursor;
+      // Changed rows can be arbitrarily old; only paging moves `oldestId`, so no page is skipped
+      save({ ...checkpoint, cursor });
+      if (!meta.has_more) return;
+    }
+    // Too far behind to catch up page by page
+    await loadFirstPage();
+  };
+
+  const run = async () => {
+    stats.syncs++;
+    stats.lastSyncBytes = 0;
+    stats.lastSyncRows = 0;
+    if (checkpoint.cursor) {
+      await loadChanges();
+    } else {
+      await loadFirstPage();
+    }
+  };
+
+  return {
+    // Concurrent callers (focus, socket gap, pull to refresh) share one request
+    sync(): Promise<void> {
+      if (!syncing) {
+        syncing = run().finally(() => {
+          syncing = null;
+        });
+      }
+      return syncing;
+    },
+
+    loadOlder(limit = pageSize): Promise<void> {
+      if (checkpoint.complete || checkpoint.oldestId == null) return Promise.resolve();
+      if (!loadingOlder) {
+        loadingOlder = (async () => {
+          const { data, meta } = await fetchPage({ before_id: checkpoint.oldestId!, limit }, false);
+          if (data.length) merge(data);
+          save({
+            ...checkpoint,
+            oldestId: lowestId(data, checkpoint.oldestId),
+            complete: !meta?.has_more || data.length === 0,
+          });
+        })().finally(() => {
+          loadingOlder = null;
+        });
+      }
+      return loadingOlder;
+    },
+
+    restore(saved: HistoryCheckpoint | null) {
+      checkpoint = saved ?? emptyCheckpoint();
+    },
+
+    reset() {
+      save(emptyCheckpoint());
+    },
+
+    checkpoint: () => checkpoint,
+    stats: () => ({ ...stats }),
+  };
+};
+
+export type HistorySync<T extends { id: number }> = ReturnType<typeof createHistorySync<T>>;
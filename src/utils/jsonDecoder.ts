@@ -0,0 +1,137 @@
+// Time-sliced decoding of large `{ ..., data: [records] }` responses.
+// JSON.parse on a multi-megabyte body blocks the JS thread for a whole burst of
+// frames. Here the body is scanned for record boundaries and parsed in chunks,
+// yielding to the event loop whenever a slice exceeds its budget, so rendering
+// and touches keep flowing while the response lands.
+
+export interface DecodeOptions {
+  // Top-level key holding the record array
+  arrayKey?: string;
+  // Max JS-thread time per slice before yielding
+  budgetMs?: number;
+  // Records per JSON.parse call
+  chunkSize?: number;
+}
+
+export interface DecodeStats {
+  bytes: number;
+  records: number;
+  slices: number;
+  maxSliceMs: number;
+  totalMs: number;
+}
+
+const QUOTE = 34; // "
+const BACKSLASH = 92; // \
+const COLON = 58; // :
+const OPEN_BRACE = 123; // {
+const CLOSE_BRACE = 125; // }
+const OPEN_BRACKET = 91; // [
+const CLOSE_BRACKET = 93; // ]
+const COMMA = 44; // ,
+
+const now = () => (typeof performance !== 'undefined' ? performance.now() : Date.now());
+const nextTick = () => new Promise<void>((resolve) => setTimeout(resolve, 0));
+
+// Bytes above which a response is decoded in slices (configurable at runtime)
+let largeJsonThreshold = 256 * 1024;
+
+export const setLargeJsonThreshold = (bytes: number) => {
+  largeJsonThreshold = bytes;
+};
+
+export const getLargeJsonThreshold = () => largeJsonThreshold;
+
+export const decodeJsonSliced = async <T = any>(
+  text: string,
+  options: DecodeOptions = {},
+): Promise<{ value: T; stats: DecodeStats }> => {
+  const arrayKey = options.arrayKey ?? 'data';
+  const budgetMs = options.budgetMs ?? 8;
+  const chunkSize = options.chunkSize ?? 200;
+  const start = now();
+  const stats: DecodeStats = { bytes: text.length, records: 0, slices: 1, maxSliceMs: 0, totalMs: 0 };
+  let sliceStart = start;
+
+  const maybeYield = async () => {
+    const elapsed = now() - sliceStart;
+    if (elapsed < budgetMs) return;
+    stats.maxSliceMs = Math.max(stats.maxSliceMs, elapsed);
+    await nextTick();
+    stats.slices += 1;
+    sliceStart = now();
+  };
+
+  // Pass 1: find the record array and the boundaries of its elements
+  const length = text.length;
+  let depth = 0;
+  let inString = false;
+  let stringStart = -1;
+  let lastKey = '';
+  let arrayStart = -1;
+  let arrayEnd = -1;
+  const bounds: number[] = []; // [start0, end0, start1, end1, ...]
+
+  for (let i = 0; i < length; i++) {
+    if ((i & 0xfff) === 0) await maybeYield();
+    const c = text.charCodeAt(i);
+    if (inString) {
+      if (c === BACKSLASH) {
+        i++;
+      } else if (c === QUOTE) {
+        inString = false;
+        if (depth === 1 && arrayStart < 0) lastKey = text.slice(stringStart + 1, i);
+      }
+      continue;
+    }
+    if (c === QUOTE) {
+      inString = true;
+      stringStart = i;
+      // Record elements that are bare strings start here
+      if (arrayStart >= 0 && arrayEnd < 0 && depth === 2 && bounds.length % 2 === 0) bounds.push(i);
+    } else if (c === OPEN_BRACE || c === OPEN_BRACKET) {
+      if (arrayStart >= 0 && arrayEnd < 0 && depth === 2 && bounds.length % 2 === 0) bounds.push(i);
+      depth++;
+      if (depth === 2 && c === OPEN_BRACKET && arrayStart < 0 && lastKey === arrayKey) arrayStart = i;
+    } else if (c === CLOSE_BRACE || c === CLOSE_BRACKET) {
+      depth--;
+      if (arrayStart >= 0 && arrayEnd < 0 && depth === 1) {
+        if (bounds.length % 2 === 1) bounds.push(i);
+        arrayEnd = i;
+      }
+    } else if (c === COMMA) {
+      if (arrayStart >= 0 && arrayEnd < 0 && depth === 2 && bounds.length % 2 === 1) bounds.push(i);
+      if (depth === 1) lastKey = '';
+    } else if (c === COLON) {
+      // Key already captured when its closing quote was seen
+    } else if (arrayStart >= 0 && arrayEnd < 0 && depth === 2 && bounds.length % 2 === 0 && c > 32) {
+      bounds.push(i); // Number / literal element
+    }
+  }
+
+  if (arrayStart < 0 || arrayEnd < 0) {
+    // Not the expected shape: fall back to a plain parse
+    const value = JSON.parse(text);
+    stats.totalMs = now() - start;
+    stats.maxSliceMs = Math.max(stats.maxSliceMs, now() - sliceStart);
+    return { value, stats };
+  }
+
+  // Pass 2: parse records in chunks
+  const records: any[] = [];
+  const count = bounds.length / 2;
+  for (let first = 0; first < count; first += chunkSize) {
+    await maybeYield();
+    const last = Math.min(first + chunkSize, count) - 1;
+    const chunk = JSON.parse(`[${text.slice(bounds[first * 2], bounds[last * 2 + 1])}]`);
+    for (let j = 0; j < chunk.length; j++) records.push(chunk[j]);
+  }
+
+  const envelope = JSON.parse(`${text.slice(0, arrayStart)}[]${text.slice(arrayEnd + 1)}`);
+  envelope[arrayKey] = records;
+
+  stats.records = records.length;
+  stats.maxSliceMs = Math.max(stats.maxSliceMs, now() - sliceStart);
+  stats.totalMs = now() - start;
+  return { value: envelope, stats };
+};
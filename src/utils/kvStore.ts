@@ -0,0 +1,120 @@
+import AsyncStorage from '@react-native-async-storage/async-storage';
+
+// Synchronous in-memory view of a few hot AsyncStorage keys (token, user, language).
+// Loaded once with a single multiGet; reads never cross the bridge afterwards and
+// parsed objects are memoized. Writes update memory immediately and are flushed to
+// AsyncStorage write-behind, coalesced per tick into one multiSet/multiRemove.
+//
+// Durability is AsyncStorage's: a write is on disk once `flushed()` resolves, and
+// `flushed()` rejects if the batch failed (the keys stay dirty and go out with the
+// next flush). TokenManager awaits it, so saveToken/removeToken fail loudly rather
+// than leaving the token only in memory. The persistence is AsyncStorage rather than
+// a native mmap log because the app ships no custom native modules yet (only the
+// generated MainActivity/MainApplication); adding one is a native build change of
+// its own, and this module keeps the synchronous API it would sit behind.
+export const HOT_KEYS = ['token', 'user', 'user-language'] as const;
+export type HotKey = (typeof HOT_KEYS)[number];
+
+const values = new Map<HotKey, string | null>();
+const parsed = new Map<HotKey, any>();
+const dirty = new Set<HotKey>();
+let loading: Promise<void> | null = null;
+let flushing: Promise<void> = Promise.resolve();
+let flushScheduled = false;
+
+const flush = () => {
+  flushScheduled = false;
+  const keys = Array.from(dirty);
+  dirty.clear();
+  const toSet: [string, string][] = [];
+  const toRemove: string[] = [];
+  for (const key of keys) {
+    const value = values.get(key);
+    if (value == null) {
+      toRemove.push(key);
+    } else {
+      toSet.push([key, value]);
+    }
+  }
+  // Chain flushes so writes land in order, even after a failed one
+  const batch = flushing
+    .catch(() => {})
+    .then(async () => {
+      if (toSet.length) await AsyncStorage.multiSet(toSet);
+      if (toRemove.length) await AsyncStorage.multiRemove(toRemove);
+    });
+  flushing = batch;
+  batch.catch((error) => {
+    console.log('KV store flush error:', error);
+    keys.forEach((key) => dirty.add(key));
+  });
+};
+
+const write = (key: HotKey, value: string | null) => {
+  values.set(key, value);
+  parsed.delete(key);
+  dirty.add(key);
+  if (!flushScheduled) {
+    flushScheduled = true;
+    setTimeout(flush, 0);
+  }
+};
+
+export const KVStore = {
+  // Resolves once the hot keys are in memory; cheap to await repeatedly
+  ready() {
+    if (!loading) {
+      loading = AsyncStorage.multiGet(HOT_KEYS as unknown as string[])
+        .then((pairs) => {
+          for (const [key, value] of pairs) {
+            // A write that raced the load wins
+            if (!values.has(key as HotKey)) values.set(key as HotKey, value);
+          }
+        })
+        .catch((error) => {
+          console.log('KV store load error:', error);
+        });
+    }
+    return loading;
+  },
+
+  getString(key: HotKey): string | null {
+    return values.get(key) ?? null;
+  },
+
+  setString(key: HotKey, value: string) {
+    write(key, value);
+  },
+
+  // Parsed once per write; callers share the returned object and must not mutate it
+  getObject<T = any>(key: HotKey): T | null {
+    if (parsed.has(key)) return parsed.get(key);
+    const raw = values.get(key);
+    let value = null;
+    try {
+      value = raw ? JSON.parse(raw) : null;
+    } catch (error) {
+      console.log('KV store parse error:', error);
+    }
+    parsed.set(key, value);
+    return value;
+  },
+
+  setObject(key: HotKey, value: any) {
+    write(key, JSON.stringify(value));
+    parsed.set(key, value);
+  },
+
+  remove(key: HotKey) {
+    write(key, null);
+  },
+
+  // Resolves when every pending write has reached AsyncStorage, rejects if the
+  // last batch failed
+  flushed() {
+    if (flushScheduled || dirty.size) flush();
+    return flushing;
+  },
+};
+
+export default KVStore;
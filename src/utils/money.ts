@@ -0,0 +1,227 @@
+// Exact money arithmetic. Amounts are bigint counts of the smallest unit we keep:
+// USDT in micro-units (6 decimals), VND in whole dong. Rates and fee percents are
+// held at 6 decimals too, so a quote is integer math with one explicit rounding step
+// per result instead of float division and toFixed.
+
+export const USDT_SCALE = 6;
+export const VND_SCALE = 0;
+export const RATE_SCALE = 6;
+
+export type Rounding = 'down' | 'up' | 'half-up' | 'half-even';
+
+const TEN = BigInt(10);
+const ZERO = BigInt(0);
+const ONE = BigInt(1);
+const TWO = BigInt(2);
+const HUNDRED = BigInt(100);
+
+const POWERS: bigint[] = [];
+export const pow10 = (n: number) => {
+  if (POWERS[n] === undefined) POWERS[n] = TEN ** BigInt(n);
+  return POWERS[n];
+};
+
+const abs = (n: bigint) => (n < ZERO ? -n : n);
+
+// n / d rounded with `mode`; d > 0. 'down' and 'up' are toward / away from zero
+export const divide = (n: bigint, d: bigint, mode: Rounding): bigint => {
+  const q = n / d;
+  const r = n % d;
+  if (r === ZERO) return q;
+  const away = n < ZERO ? q - ONE : q + ONE;
+  switch (mode) {
+    case 'down':
+      return q;
+    case 'up':
+      return away;
+    case 'half-up':
+    case 'half-even': {
+      const twice = abs(r) * TWO;
+      if (twice > d) return away;
+      if (twice < d) return q;
+      return mode === 'half-up' || q % TWO !== ZERO ? away : q;
+    }
+  }
+};
+
+// Units at `from` decimals -> units at `to` decimals
+export const rescale = (units: bigint, from: number, to: number, mode: Rounding) =>
+  to >= from ? units * pow10(to - from) : divide(units, pow10(from - to), mode);
+
+// "1,234.5678" -> units at `scale` decimals; digits past the scale are rounded with
+// `mode`. Commas are grouping. null when the text is not a plain decimal.
+export const parseDecimal = (text: string, scale: number, mode: Rounding = 'half-up'): bigint | null => {
+  const match = /^\s*(-?)(\d*)(?:\.(\d*))?\s*$/.exec(text.replace(/,/g, ''));
+  if (!match || (!match[2] && !match[3])) return null;
+  const fraction = match[3] ?? '';
+  const digits = BigInt((match[2] || '0') + fraction);
+  const units = rescale(digits, fraction.length, scale, mode);
+  return match[1] ? -units : units;
+};
+
+// Numbers from the API (rate 26450.5, fee 0.5): their shortest decimal form, so 0.1
+// is exactly 0.1 and not the binary approximation
+export const fromNumber = (value: number, scale: number, mode: Rounding = 'half-up'): bigint | null => {
+  if (!Number.isFinite(value)) return null;
+  const text = String(value);
+  return parseDecimal(/e/i.test(text) ? value.toFixed(Math.min(scale + 1, 100)) : text, scale, mode);
+};
+
+// 2640000 -> "2,640,000"
+export const groupDigits = (digits: string, separator: string) => {
+  const head = digits.length % 3 || 3;
+  let out = digits.slice(0, head);
+  for (let i = head; i < digits.length; i += 3) out += separator + digits.slice(i, i + 3);
+  return out;
+};
+
+type FormatOptions = {
+  // Fraction digits shown; the value is rounded to this many first
+  digits?: number;
+  // Trailing zeros kept down to this many fraction digits (default: `digits`)
+  minDigits?: number;
+  mode?: Rounding;
+  group?: string;
+  decimal?: string;
+};
+
+// Units at `scale` -> "1,234.50". Without `group` the output is a plain decimal that
+// parses back exactly (what goes on the wire).
+export const formatUnits = (units: bigint, scale: number, options: FormatOptions = {}) => {
+  const { digits = scale, mode = 'half-up', group = '', decimal = '.' } = options;
+  const minDigits = options.minDigits ?? digits;
+  const rounded = rescale(units, scale, digits, mode);
+  const text = abs(rounded).toString().padStart(digits + 1, '0');
+  const whole = text.slice(0, text.length - digits);
+  let fraction = text.slice(text.length - digits);
+  let end = fraction.length;
+  while (end > minDigits && fraction[end - 1] === '0') end--;
+  fraction = fraction.slice(0, end);
+  const sign = rounded < ZERO ? '-' : '';
+  return `${sign}${group ? groupDigits(whole, group) : whole}${fraction ? decimal + fraction : ''}`;
+};
+
+// Plain decimal for request bodies: 37807183n -> 37.807183 (JSON prints the number
+// with exactly these digits)
+export const toApiNumber = (units: bigint, scale: number) => Number(formatUnits(units, scale, { minDigits: 0 }));
+
+// VND needed for / received from `usdt` micro-units at `rate` (VND per USDT, RATE_SCALE)
+export const usdtToVnd = (usdt: bigint, rate: bigint, mode: Rounding) =>
+  divide(usdt * rate, pow10(USDT_SCALE + RATE_SCALE - VND_SCALE), mode);
+
+// USDT micro-units bought with / needed for `vnd`
+export const vndToUsdt = (vnd: bigint, rate: bigint, mode: Rounding) =>
+  rate > ZERO ? divide(vnd * pow10(USDT_SCALE + RATE_SCALE - VND_SCALE), rate, mode) : ZERO;
+
+// `percent` (RATE_SCALE, 0.5% -> 500000n) of `units`, same scale as `units`
+export const percentOf = (units: bigint, percent: bigint, mode: Rounding) =>
+  divide(units * percent, HUNDRED * pow10(RATE_SCALE), mode);
+
+// Buy: `vnd` paid for USDT (never more USDT than the VND covers), fee on top
+export const quoteBuy = (vnd: bigint, rate: bigint, feePercent: bigint) => {
+  const fee = percentOf(vnd, feePercent, 'half-up');
+  return { usdt: vndToUsdt(vnd, rate, 'down'), fee, total: vnd + fee };
+};
+
+// Sell: `usdt` micro-units for VND, fee taken out of the proceeds
+export const quoteSell = (usdt: bigint, rate: bigint, feePercent: bigint) => {
+  const gross = usdtToVnd(usdt, rate, 'down');
+  const fee = percentOf(gross, feePercent, 'half-up');
+  return { gross, fee, receive: gross - fee };
+};
+
+// Fee fractions from the API (0.0035) as a percent string ("0.35"), no float noise
+export const formatPercent = (fraction: number | null | undefined, digits?: number) => {
+  const units = fromNumber(Number(fraction ?? 0), RATE_SCALE + 2);
+  if (units === null) return '0';
+  // fraction * 100 is a shift of two decimals
+  return formatUnits(units, RATE_SCALE, digits === undefined ? { minDigits: 0 } : { digits });
+};
+
+// --- Keypad entry ---------------------------------------------------------------
+//
+// The amount being typed on Home. Each key updates the value and its display string
+// from the previous entry: a fraction digit appends one character, an integer digit
+// regroups only the integer part, and the value moves by one scaled digit.
+
+export type EntryRule = {
+  // Scale of `units` (USDT_SCALE / VND_SCALE)
+  scale: number;
+  // Fraction digits the user may type
+  maxFraction: number;
+};
+
+export type AmountEntry = {
+  // What was typed, without grouping: "1234.5"
+  raw: string;
+  // Integer digits, "" before the first one
+  whole: string;
+  // Fraction digits typed, null before the decimal point
+  fraction: string | null;
+  units: bigint;
+  // Grouped with ',': "1,234.5"
+  display: string;
+  rule: EntryRule;
+};
+
+export const VND_ENTRY: EntryRule = { scale: VND_SCALE, maxFraction: 0 };
+export const USDT_ENTRY: EntryRule = { scale: USDT_SCALE, maxFraction: 2 };
+
+const build = (rule: EntryRule, whole: string, fraction: string | null, units: bigint): AmountEntry => {
+  const grouped = whole ? groupDigits(whole, ',') : '';
+  const raw = fraction === null ? whole : `${whole}.${fraction}`;
+  return {
+    raw,
+    whole,
+    fraction,
+    units,
+    display: raw ? (fraction === null ? grouped : `${grouped || '0'}.${fraction}`) : '0',
+    rule,
+  };
+};
+
+export const emptyEntry = (rule: EntryRule) => build(rule, '', null, ZERO);
+
+// Entry after pressing `key` ('0'-'9' or '.'); the same entry when the key is not
+// allowed here (second point, too many decimals, point on an integer amount)
+export const pressKey = (entry: AmountEntry, key: string): AmountEntry => {
+  const { rule, whole, fraction, units } = entry;
+  if (key === '.') {
+    if (fraction !== null || rule.maxFraction === 0) return entry;
+    return build(rule, whole || '0', '', units);
+  }
+  if (key.length !== 1 || key < '0' || key > '9') return entry;
+  const digit = BigInt(key.charCodeAt(0) - 48);
+  if (fraction !== null) {
+    if (fraction.length >= rule.maxFraction) return entry;
+    const next = fraction + key;
+    const value = units + digit * pow10(rule.scale - next.length);
+    return { ...entry, raw: entry.raw + key, fraction: next, units: value, display: entry.display + key };
+  }
+  // A leading zero is replaced, not extended
+  const nextWhole = whole === '0' ? key : whole + key;
+  const value = (whole === '0' ? ZERO : units * TEN) + digit * pow10(rule.scale);
+  return build(rule, nextWhole, null, value);
+};
+
+export const deleteKey = (entry: AmountEntry): AmountEntry => {
+  const { rule, whole, fraction, units } = entry;
+  if (fraction !== null) {
+    if (fraction === '') return build(rule, whole, null, units);
+    const digit = BigInt(fraction.charCodeAt(fraction.length - 1) - 48);
+    const value = units - digit * pow10(rule.scale - fraction.length);
+    const next = fraction.slice(0, -1);
+    return { ...entry, raw: entry.raw.slice(0, -1), fraction: next, units: value, display: entry.display.slice(0, -1) };
+  }
+  if (!whole) return entry;
+  const digit = BigInt(whole.charCodeAt(whole.length - 1) - 48);
+  return build(rule, whole.slice(0, -1), null, (units - digit * pow10(rule.scale)) / TEN);
+};
+
+// Entry for a whole value (shortcut buttons); digits beyond the rule are cut
+export const entryFromText = (rule: EntryRule, text: string): AmountEntry | null => {
+  const parsed = parseDecimal(text, rule.maxFraction, 'down');
+  if (parsed === null || parsed < ZERO) return null;
+  const [whole, fraction] = formatUnits(parsed, rule.maxFraction, { minDigits: 0 }).split('.');
+  return build(rule, whole, fraction ?? null, rescale(parsed, rule.maxFraction, rule.scale, 'down'));
+};
@@ -0,0 +1,277 @@
+// QR module matrix -> PNG data URI, rasterized once at the device pixel size so a
+// single <Image> shows it sharp. Two-colour palette PNG (1 bit per pixel); the zlib
+// stream uses fixed Huffman codes and back-references to the previous scanline, so
+// the `scale` identical rows of each module row cost a few bytes each.
+
+export type QrModules = {
+  // Modules per side
+  size: number;
+  // size * size, truthy = dark
+  data: ArrayLike<number | boolean>;
+};
+
+export type QrRaster = {
+  uri: string;
+  // Image side in device pixels
+  pixels: number;
+  bytes: number;
+};
+
+// --- zlib (RFC 1950/1951), fixed Huffman only ---------------------------------------
+
+const LENGTH_BASE = [3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258];
+const LENGTH_EXTRA = [0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0];
+const DIST_BASE = [1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577];
+const DIST_EXTRA = [0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13];
+
+class BitWriter {
+  out: Uint8Array;
+  length = 0;
+  private bits = 0;
+  private count = 0;
+
+  constructor(capacity: number) {
+    this.out = new Uint8Array(Math.max(64, capacity));
+  }
+
+  private byte(value: number) {
+    if (this.length === this.out.length) {
+      const grown = new Uint8Array(this.out.length * 2);
+      grown.set(this.out);
+      this.out = grown;
+    }
+    this.out[this.length++] = value;
+  }
+
+  // `n` bits of `value`, least significant first
+  write(value: number, n: number) {
+    this.bits |= value << this.count;
+    this.count += n;
+    while (this.count >= 8) {
+      this.byte(this.bits & 0xff);
+      this.bits >>>= 8;
+      this.count -= 8;
+    }
+  }
+
+  // Huffman codes go most significant bit first
+  code(value: number, n: number) {
+    let reversed = 0;
+    for (let i = 0; i < n; i++) reversed |= ((value >> i) & 1) << (n - 1 - i);
+    this.write(reversed, n);
+  }
+
+  flush() {
+    if (this.count > 0) this.byte(this.bits & 0xff);
+    this.bits = 0;
+    this.count = 0;
+  }
+}
+
+const literal = (w: BitWriter, value: number) => {
+  if (value < 144) w.code(0x30 + value, 8);
+  else w.code(0x190 + value - 144, 9);
+};
+
+const symbol = (w: BitWriter, value: number) => {
+  // 256..287
+  if (value < 280) w.code(value - 256, 7);
+  else w.code(0xc0 + value - 280, 8);
+};
+
+// Upper bound search over a short table
+const bucket = (base: number[], value: number) => {
+  let i = base.length - 1;
+  while (base[i] > value) i--;
+  return i;
+};
+
+const match = (w: BitWriter, length: number, distance: number) => {
+  const l = bucket(LENGTH_BASE, length);
+  symbol(w, 257 + l);
+  if (LENGTH_EXTRA[l]) w.write(length - LENGTH_BASE[l], LENGTH_EXTRA[l]);
+  const d = bucket(DIST_BASE, distance);
+  w.code(d, 5);
+  if (DIST_EXTRA[d]) w.write(distance - DIST_BASE[d], DIST_EXTRA[d]);
+};
+
+// Copy of `length` bytes from `distance` back, in chunks deflate allows (3..258)
+const copy = (w: BitWriter, length: number, distance: number) => {
+  while (length > 0) {
+    let chunk = Math.min(length, 258);
+    // Leave at least 3 for the last chunk
+    if (length - chunk > 0 && length - chunk < 3) chunk = length - 3;
+    match(w, chunk, distance);
+    length -= chunk;
+  }
+};
+
+const adler32 = (data: Uint8Array) => {
+  let a = 1;
+  let b = 0;
+  for (let i = 0; i < data.length; i++) {
+    a = (a + data[i]) % 65521;
+    b = (b + a) % 65521;
+  }
+  return ((b << 16) | a) >>> 0;
+};
+
+// zlib stream for `raw`, made of `stride`-byte scanlines
+export const deflateScanlines = (raw: Uint8Array, stride: number) => {
+  const w = new BitWriter(raw.length / 8 + 64);
+  w.write(0x78, 8);
+  w.write(0x01, 8);
+  // One final block, fixed Huffman
+  w.write(1, 1);
+  w.write(1, 2);
+  for (let row = 0; row * stride < raw.length; row++) {
+    const start = row * stride;
+    let same = row > 0;
+    for (let i = 0; same && i < stride; i++) same = raw[start + i] === raw[start - stride + i];
+    if (same) {
+      copy(w, stride, stride);
+      continue;
+    }
+    // Literals, with runs of one byte as distance-1 copies
+    let i = 0;
+    while (i < stride) {
+      const value = raw[start + i];
+      let run = 1;
+      while (i + run < stride && raw[start + i + run] === value) run++;
+      literal(w, value);
+      if (run >= 4) {
+        copy(w, run - 1, 1);
+      } else {
+        for (let k = 1; k < run; k++) literal(w, value);
+      }
+      i += run;
+    }
+  }
+  symbol(w, 256);
+  w.flush();
+  const sum = adler32(raw);
+  w.write(sum >>> 24, 8);
+  w.write((sum >>> 16) & 0xff, 8);
+  w.write((sum >>> 8) & 0xff, 8);
+  w.write(sum & 0xff, 8);
+  return w.out.subarray(0, w.length);
+};
+
+// --- PNG ---------------------------------------------------------------------------
+
+const CRC_TABLE = (() => {
+  const table = new Int32Array(256);
+  for (let n = 0; n < 256; n++) {
+    let c = n;
+    for (let k = 0; k < 8; k++) c = c & 1 ? 0xedb88320 ^ (c >>> 1) : c >>> 1;
+    table[n] = c;
+  }
+  return table;
+})();
+
+const crc32 = (data: Uint8Array, from: number, to: number) => {
+  let c = -1;
+  for (let i = from; i < to; i++) c = CRC_TABLE[(c ^ data[i]) & 0xff] ^ (c >>> 8);
+  return (c ^ -1) >>> 0;
+};
+
+const u32 = (out: Uint8Array, at: number, value: number) => {
+  out[at] = value >>> 24;
+  out[at + 1] = (value >>> 16) & 0xff;
+  out[at + 2] = (value >>> 8) & 0xff;
+  out[at + 3] = value & 0xff;
+};
+
+const chunk = (type: string, data: Uint8Array) => {
+  const out = new Uint8Array(12 + data.length);
+  u32(out, 0, data.length);
+  for (let i = 0; i < 4; i++) out[4 + i] = type.charCodeAt(i);
+  out.set(data, 8);
+  u32(out, 8 + data.length, crc32(out, 4, 8 + data.length));
+  return out;
+};
+
+// "#1A1A1A" / "#fff" -> [r, g, b]
+const rgb = (color: string) => {
+  let hex = color.replace('#', '');
+  if (hex.length === 3) hex = hex.replace(/./g, (c) => c + c);
+  const n = parseInt(hex.slice(0, 6), 16);
+  return isNaN(n) ? [0, 0, 0] : [n >> 16, (n >> 8) & 0xff, n & 0xff];
+};
+
+// PNG bytes of the matrix with `quiet` modules of margin, `scale` pixels per module
+export const encodeQrPng = (modules: QrModules, scale: number, quiet: number, dark: string, light: string) => {
+  const side = (modules.size + quiet * 2) * scale;
+  const stride = 1 + Math.ceil(side / 8);
+  const raw = new Uint8Array(stride * side);
+  // Palette index 1 = light, so margins and light modules are set bits
+  for (let y = 0; y < side; y++) {
+    const row = Math.floor(y / scale) - quiet;
+    const line = y * stride;
+    // Same module row as the line above: copy it
+    if (y % scale !== 0) {
+      raw.copyWithin(line, line - stride, line);
+      continue;
+    }
+    for (let x = 0; x < side; x++) {
+      const col = Math.floor(x / scale) - quiet;
+      const isDark =
+        row >= 0 && row < modules.size && col >= 0 && col < modules.size && !!modules.data[row * modules.size + col];
+      if (!isDark) raw[line + 1 + (x >> 3)] |= 0x80 >> (x & 7);
+    }
+  }
+
+  const header = new Uint8Array(13);
+  u32(header, 0, side);
+  u32(header, 4, side);
+  header[8] = 1; // bit depth
+  header[9] = 3; // palette
+  const palette = new Uint8Array([...rgb(dark), ...rgb(light)]);
+  const parts = [
+    new Uint8Array([0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a]),
+    chunk('IHDR', header),
+    chunk('PLTE', palette),
+    chunk('IDAT', deflateScanlines(raw, stride)),
+    chunk('IEND', new Uint8Array(0)),
+  ];
+  const png = new Uint8Array(parts.reduce((n, part) => n + part.length, 0));
+  let at = 0;
+  for (const part of parts) {
+    png.set(part, at);
+    at += part.length;
+  }
+  return png;
+};
+
+const BASE64 = 'ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/';
+
+export const toBase64 = (bytes: Uint8Array) => {
+  let out = '';
+  let i = 0;
+  for (; i + 2 < bytes.length; i += 3) {
+    const n = (bytes[i] << 16) | (bytes[i + 1] << 8) | bytes[i + 2];
+    out += BASE64[n >> 18] + BASE64[(n >> 12) & 63] + BASE64[(n >> 6) & 63] + BASE64[n & 63];
+  }
+  if (i < bytes.length) {
+    const n = (bytes[i] << 16) | ((bytes[i + 1] ?? 0) << 8);
+    out += BASE64[n >> 18] + BASE64[(n >> 12) & 63] + (i + 1 < bytes.length ? BASE64[(n >> 6) & 63] : '=') + '=';
+  }
+  return out;
+};
+
+// Largest whole number of device pixels per module that fits `pixels`
+export const rasterizeQr = (
+  modules: QrModules,
+  pixels: number,
+  quiet: number,
+  dark: string,
+  light: string,
+): QrRaster => {
+  const scale = Math.max(1, Math.floor(pixels / (modules.size + quiet * 2)));
+  const png = encodeQrPng(modules, scale, quiet, dark, light);
+  return {
+    uri: `data:image/png;base64,${toBase64(png)}`,
+    pixels: (modules.size + quiet * 2) * scale,
+    bytes: png.length,
+  };
+};
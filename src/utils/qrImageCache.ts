@@ -0,0 +1,76 @@
+import CryptoJS from 'crypto-js';
+import { create, type QRCodeErrorCorrectionLevel } from 'qrcode';
+import { rasterizeQr, type QrRaster } from './qrImage';
+
+// Rasterized QR codes, one PNG per (payload, pixel size, error correction, colours),
+// kept in a small in-memory LRU for instant re-renders. Never written to disk: the
+// payloads are deposit addresses and payment requests, and the cache is dropped on
+// logout with the rest of the session.
+const MEMORY_ENTRIES = 32;
+
+export type QrImageSpec = {
+  value: string;
+  // Target side in device pixels; the quiet zone is left to the caller's layout
+  pixels: number;
+  ecl: QRCodeErrorCorrectionLevel;
+  dark: string;
+  light: string;
+};
+
+const memory = new Map<string, QrRaster>();
+const pending = new Map<string, Promise<QrRaster>>();
+// Bumped by clear(), so an encode started before logout is not cached after it
+let generation = 0;
+
+export const qrImageKey = (spec: QrImageSpec) =>
+  CryptoJS.SHA256(
+    [spec.ecl, spec.pixels, spec.dark, spec.light, spec.value].join('|'),
+  ).toString();
+
+const remember = (key: string, raster: QrRaster) => {
+  memory.delete(key);
+  memory.set(key, raster);
+  if (memory.size > MEMORY_ENTRIES) {
+    memory.delete(memory.keys().next().value as string);
+  }
+  return raster;
+};
+
+const generate = (spec: QrImageSpec) => {
+  const { modules } = create(spec.value, { errorCorrectionLevel: spec.ecl });
+  return rasterizeQr(modules, spec.pixels, 0, spec.dark, spec.light);
+};
+
+export const QrImageCache = {
+  // Synchronous hit from memory, so a re-mounted QR renders on its first frame
+  peek(spec: QrImageSpec): QrRaster | undefined {
+    const key = qrImageKey(spec);
+    const hit = memory.get(key);
+    return hit && remember(key, hit);
+  },
+
+  // Memory, else encode once off the render path; concurrent callers share the work
+  get(spec: QrImageSpec): Promise<QrRaster> {
+    const key = qrImageKey(spec);
+    const hit = memory.get(key);
+    if (hit) return Promise.resolve(remember(key, hit));
+    let job = pending.get(key);
+    if (!job) {
+      const started = generation;
+      job = Promise.resolve()
+        .then(() => {
+          const raster = generate(spec);
+          return started === generation ? remember(key, raster) : raster;
+        })
+        .finally(() => pending.delete(key));
+      pending.set(key, job);
+    }
+    return job;
+  },
+
+  clear() {
+    generation++;
+    memory.clear();
+    pending.clear();
+  },
+};
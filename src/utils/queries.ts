@@ -0,0 +1,45 @@
+import api, { batcher } from './Api';
+import { getUser } from './TokenManager';
+import { Query } from './queryCache';
+
+// Data each detail screen needs on mount, shared by the screen and its prefetchers
+type TradeType = 'buy' | 'sell';
+
+const transactionQuery = (
+  kind: 'pending' | 'success' | 'failed',
+  type: TradeType | undefined,
+  idTransaction: number,
+): Query<any> => ({
+  key: `transaction-${kind}:${type === 'sell' ? 'sell' : 'buy'}:${idTransaction}`,
+  fetcher: async (signal) => {
+    const user = await getUser();
+    const endpoint = type === 'sell'
+      ? `/client/transaction-${kind}/usdt-vnd`
+      : `/client/transaction-${kind}/vnd-usdt`;
+    const res = await api.post(endpoint, {
+      email: user?.email ?? '',
+      id_transaction: idTransaction,
+    }, { signal });
+    return res.data;
+  },
+});
+
+export const pendingTransactionQuery = (type: TradeType | undefined, idTransaction: number) =>
+  transactionQuery('pending', type, idTransaction);
+
+export const successTransactionQuery = (type: TradeType | undefined, idTransaction: number) =>
+  transactionQuery('success', type, idTransaction);
+
+export const failedTransactionQuery = (type: TradeType | undefined, idTransaction: number) =>
+  transactionQuery('failed', type, idTransaction);
+
+// GETs go through the batcher so they still share a round trip with the screen's other calls
+export const bankAccountsQuery: Query<any> = {
+  key: 'bank-accounts',
+  fetcher: async () => (await batcher.get('/client/bank/data')).data,
+};
+
+export const walletsQuery: Query<any> = {
+  key: 'wallets',
+  fetcher: async () => (await batcher.get('/client/wallet/data')).data,
+};
@@ -0,0 +1,101 @@
+// Keyed in-memory cache for screen data with in-flight dedupe and prefetch.
+// Screens read through `fetch`; list rows call `prefetch` on press-in so the
+// request is already in flight (or done) by the time the target screen mounts.
+
+export type Fetcher<T> = (signal: AbortSignal) => Promise<T>;
+
+export interface Query<T> {
+  key: string;
+  fetcher: Fetcher<T>;
+}
+
+type Entry = {
+  data?: any;
+  at: number;
+  promise?: Promise<any>;
+  controller?: AbortController;
+  // Prefetch nobody has read yet: may be cancelled by a newer prefetch
+  speculative: boolean;
+};
+
+// Prefetched data older than this is discarded instead of shown
+const PREFETCH_TTL = 30 * 1000;
+
+const entries = new Map<string, Entry>();
+let lastPrefetchKeys: string[] = [];
+
+const start = <T>(query: Query<T>, speculative: boolean): Entry => {
+  const controller = new AbortController();
+  const entry: Entry = { at: 0, controller, speculative };
+  entry.promise = query.fetcher(controller.signal).then(
+    (data) => {
+      if (entries.get(query.key) === entry) {
+        entry.data = data;
+        entry.at = Date.now();
+        entry.promise = undefined;
+        entry.controller = undefined;
+      }
+      return data;
+    },
+    (error) => {
+      if (entries.get(query.key) === entry) entries.delete(query.key);
+      throw error;
+    },
+  );
+  // Unread prefetch failures must not surface as unhandled rejections
+  entry.promise.catch(() => {});
+  entries.set(query.key, entry);
+  return entry;
+};
+
+const isFresh = (entry: Entry, maxAge: number) =>
+  entry.promise != null || (entry.at > 0 && Date.now() - entry.at < maxAge);
+
+export const QueryCache = {
+  // Returns cached data younger than maxAge, joins an in-flight request, or fetches
+  fetch<T>(query: Query<T>, maxAge = PREFETCH_TTL): Promise<T> {
+    const entry = entries.get(query.key);
+    if (entry && isFresh(entry, maxAge)) {
+      entry.speculative = false;
+      return entry.promise ?? Promise.resolve(entry.data);
+    }
+    return start(query, false).promise!;
+  },
+
+  // Fire-and-forget warm-up on navigation intent; all queries of one target screen at once
+  prefetch(...queries: Query<any>[]) {
+    const keys = queries.map((q) => q.key);
+    // A newer intent supersedes unread prefetches for a different target
+    for (const key of lastPrefetchKeys) {
+      const previous = entries.get(key);
+      if (!keys.includes(key) && previous?.speculative && previous.promise) {
+        previous.controller?.abort();
+        entries.delete(key);
+      }
+    }
+    lastPrefetchKeys = keys;
+
+    for (const query of queries) {
+      const entry = entries.get(query.key);
+      if (!entry || !isFresh(entry, PREFETCH_TTL)) start(query, true);
+    }
+  },
+
+  peek<T>(key: string): T | undefined {
+    const entry = entries.get(key);
+    return entry && isFresh(entry, PREFETCH_TTL) ? entry.data : undefined;
+  },
+
+  invalidate(key: string) {
+    entries.get(key)?.controller?.abort();
+    entries.delete(key);
+  },
+
+  clear() {
+    entries.forEach((entry) => entry.controller?.abort());
+    entries.clear();
+    lastPrefetchKeys = [];
+  },
+};
+
+export default QueryCache;
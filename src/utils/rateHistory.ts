@@ -0,0 +1,191 @@
+// Rate history for charts: a fixed-size ring of (time, value) ticks and
+// Largest-Triangle-Three-Buckets downsampling, so a chart draws about one point
+// per pixel column however long the history is.
+
+export interface TickRing {
+  push(time: number, value: number): void;
+  // Absolute indices: ticks `start()` .. `end() - 1` are held; older ones were overwritten
+  start(): number;
+  end(): number;
+  time(index: number): number;
+  value(index: number): number;
+  clear(): void;
+  // Called after every push / clear
+  subscribe(listener: () => void): () => void;
+}
+
+// Capacity is rounded up to a power of two so indexing is a mask
+export const createTickRing = (capacity: number): TickRing => {
+  let size = 1;
+  while (size < capacity) size *= 2;
+  const mask = size - 1;
+  const times = new Float64Array(size);
+  const values = new Float64Array(size);
+  const listeners = new Set<() => void>();
+  let total = 0;
+
+  const notify = () => listeners.forEach((listener) => listener());
+
+  return {
+    push(time, value) {
+      times[total & mask] = time;
+      values[total & mask] = value;
+      total++;
+      notify();
+    },
+    start: () => Math.max(0, total - size),
+    end: () => total,
+    time: (index) => times[index & mask],
+    value: (index) => values[index & mask],
+    clear() {
+      total = 0;
+      notify();
+    },
+    subscribe(listener) {
+      listeners.add(listener);
+      return () => {
+        listeners.delete(listener);
+      };
+    },
+  };
+};
+
+// Indices (absolute) of at most `threshold` ticks in [from, to) that keep the
+// shape of the line: first and last always, then per bucket the tick forming the
+// largest triangle with the previous pick and the next bucket's average.
+export const lttb = (ring: TickRing, from: number, to: number, threshold: number): number[] => {
+  const count = to - from;
+  if (threshold >= count || threshold < 3) {
+    const all = new Array<number>(Math.max(0, count));
+    for (let i = 0; i < count; i++) all[i] = from + i;
+    return all;
+  }
+
+  const picked = new Array<number>(threshold);
+  const every = (count - 2) / (threshold - 2);
+  let a = from;
+  picked[0] = a;
+
+  for (let bucket = 0; bucket < threshold - 2; bucket++) {
+    // Average of the next bucket (the last tick for the final bucket)
+    const nextStart = from + Math.floor((bucket + 1) * every) + 1;
+    const nextEnd = Math.min(from + Math.floor((bucket + 2) * every) + 1, to);
+    let avgX = 0;
+    let avgY = 0;
+    for (let i = nextStart; i < nextEnd; i++) {
+      avgX += ring.time(i);
+      avgY += ring.value(i);
+    }
+    const span = nextEnd - nextStart;
+    avgX /= span;
+    avgY /= span;
+
+    const ax = ring.time(a);
+    const ay = ring.value(a);
+    const rangeStart = from + Math.floor(bucket * every) + 1;
+    const rangeEnd = nextStart;
+    let maxArea = -1;
+    let pick = rangeStart;
+    for (let i = rangeStart; i < rangeEnd; i++) {
+      // Twice the triangle area; the factor does not change the argmax
+      const area = Math.abs((ax - avgX) * (ring.value(i) - ay) - (ax - ring.time(i)) * (avgY - ay));
+      if (area > maxArea) {
+        maxArea = area;
+        pick = i;
+      }
+    }
+    picked[bucket + 1] = pick;
+    a = pick;
+  }
+
+  picked[threshold - 1] = to - 1;
+  return picked;
+};
+
+export type PathSegment = {
+  // SVG path in data units: x is seconds since `origin`, y is the value
+  d: string;
+  min: number;
+  max: number;
+};
+
+// Path through `indices`
+export const segmentPath = (ring: TickRing, indices: ArrayLike<number>, origin: number): PathSegment => {
+  let d = '';
+  let min = Infinity;
+  let max = -Infinity;
+  for (let i = 0; i < indices.length; i++) {
+    const index = indices[i];
+    const value = ring.value(index);
+    if (value < min) min = value;
+    if (value > max) max = value;
+    const x = Math.round((ring.time(index) - origin) / 10) / 100;
+    d += `${i === 0 ? 'M' : 'L'}${x} ${value}`;
+  }
+  return { d, min, max };
+};
+
+// Ticks per pixel column
+export const bucketSize = (count: number, width: number) => Math.max(1, Math.ceil(count / Math.max(1, width)));
+
+// Downsampled part of a chart, kept across frames
+export type ChartBody = PathSegment & {
+  from: number;
+  to: number;
+  width: number;
+  origin: number;
+};
+
+export type ChartFrame = {
+  body: ChartBody;
+  // Raw ticks after the body
+  tail: PathSegment;
+  // SVG matrix from data units to pixels
+  transform: string;
+};
+
+const PADDING = 4;
+
+// What the chart draws for the ring's current ticks. `previous` is reused (same
+// object, same path string) until a bucket of ticks has arrived or been evicted
+// since it was built, so most ticks only extend the tail and move the transform.
+export const layoutChart = (
+  ring: TickRing,
+  width: number,
+  height: number,
+  previous: ChartBody | null,
+): ChartFrame | null => {
+  const start = ring.start();
+  const end = ring.end();
+  if (end - start < 2) return null;
+
+  // One point per whole pixel column
+  const columns = Math.max(3, Math.floor(width));
+  const bucket = bucketSize(end - start, columns);
+  let body = previous;
+  if (!body || body.width !== width || end < body.to || end - body.to > bucket || start - body.from > bucket) {
+    const origin = ring.time(start);
+    body = { from: start, to: end, width, origin, ...segmentPath(ring, lttb(ring, start, end, columns), origin) };
+  }
+
+  // Continues from the body's last point
+  const tailIndices: number[] = [];
+  for (let i = body.to - 1; i < end; i++) tailIndices.push(i);
+  const tail = segmentPath(ring, tailIndices, body.origin);
+
+  let min = Math.min(body.min, tail.min);
+  let max = Math.max(body.max, tail.max);
+  if (max === min) {
+    min -= 0.5;
+    max += 0.5;
+  }
+  const x0 = (ring.time(start) - body.origin) / 1000;
+  const x1 = (ring.time(end - 1) - body.origin) / 1000;
+  const kx = width / Math.max(x1 - x0, 1e-3);
+  const ky = (height - PADDING * 2) / (max - min);
+  return {
+    body,
+    tail,
+    transform: `matrix(${kx} 0 0 ${-ky} ${-kx * x0} ${height - PADDING + ky * min})`,
+  };
+};
@@ -0,0 +1,68 @@
+import { parseTimestamp } from './timeIndex';
+
+// Server-locked rate quotes. /client/exchange/rate may return a quote id with an
+// expiry; the rate is then guaranteed for orders that carry that id until it
+// expires. The feed refreshes just before expiry instead of on a fixed period,
+// and an order only goes out with a quote that still has some life left.
+
+export type RateQuote = {
+  rate: number;
+  fee: number | null;
+  // null when the server does not issue quotes (plain rate feed)
+  quoteId: string | null;
+  expiresAt: number | null;
+};
+
+// Fetch the next quote this long before the current one expires
+export const QUOTE_REFRESH_LEAD = 3 * 1000;
+// Never refresh sooner than this, even for very short quotes
+export const QUOTE_MIN_REFRESH = 1000;
+// An order needs this much quote life left to reach the server in time
+export const QUOTE_ORDER_MARGIN = 2 * 1000;
+
+// expires_at as ISO string, epoch seconds or epoch ms; expires_in in seconds
+const parseExpiry = (data: any, now: number): number | null => {
+  const at = data?.expires_at;
+  if (typeof at === 'number' && isFinite(at)) return at < 1e12 ? at * 1000 : at;
+  if (typeof at === 'string' && at) {
+    const time = /^\d+$/.test(at) ? Number(at) * 1000 : parseTimestamp(at);
+    if (!isNaN(time)) return time;
+  }
+  const ttl = parseFloat(String(data?.expires_in));
+  return isNaN(ttl) ? null : now + ttl * 1000;
+};
+
+// Accepts { rate, fee, quote_id, expires_at }, a nested { quote: {...} }, and the
+// older usdt_vnd_rate / exchange_rate fields without a quote
+export const parseQuote = (data: any, now: number): RateQuote | null => {
+  const body = data?.quote && typeof data.quote === 'object' ? { ...data, ...data.quote } : data;
+  const raw = body?.rate ?? body?.usdt_vnd_rate ?? body?.exchange_rate;
+  const rate = parseFloat(String(raw));
+  if (!raw || isNaN(rate)) return null;
+
+  const fee = parseFloat(String(body?.fee));
+  const id = body?.quote_id ?? (data?.quote ? data.quote.id : undefined);
+  const quoteId = id == null || id === '' ? null : String(id);
+  return {
+    rate,
+    fee: isNaN(fee) ? null : fee,
+    quoteId,
+    expiresAt: quoteId ? parseExpiry(body, now) : null,
+  };
+};
+
+// When to fetch again: ahead of expiry for a quote, after `interval` for a plain rate
+export const refreshAt = (quote: Pick<RateQuote, 'expiresAt'>, now: number, interval: number) =>
+  quote.expiresAt == null ? now + interval : Math.max(now + QUOTE_MIN_REFRESH, quote.expiresAt - QUOTE_REFRESH_LEAD);
+
+// Whether an order may go out on this quote now. A plain rate is always usable
+export const isQuoteUsable = (quote: Pick<RateQuote, 'quoteId' | 'expiresAt'>, now: number) =>
+  !quote.quoteId || quote.expiresAt == null || quote.expiresAt - now >= QUOTE_ORDER_MARGIN;
+
+// Order rejected because its quote expired or is unknown to the server
+export const isQuoteRejection = (error: any) => {
+  const response = error?.response;
+  if (!response || ![409, 410, 422].includes(response.status)) return false;
+  const code = String(response.data?.code ?? '');
+  return code.startsWith('quote_') || /quote/i.test(String(response.data?.message ?? ''));
+};
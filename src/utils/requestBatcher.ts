@@ -0,0 +1,105 @@
+import type { AxiosInstance, AxiosResponse } from 'axios';
+
+// Collects GETs issued in the same tick into a single POST /client/batch.
+// Request:  { requests: [{ id, method: 'GET', url }] }
+// Response: { responses: [{ id, status, body }] }
+export const BATCH_ENDPOINT = '/client/batch';
+
+export interface BatchedResponse<T = any> {
+  data: T;
+  status: number;
+}
+
+type Pending = {
+  id: string;
+  url: string;
+  waiters: { resolve: (res: BatchedResponse) => void; reject: (error: any) => void }[];
+};
+
+export interface BatcherOptions {
+  // Called for each sub-response served from a batch (e.g. per-route metrics); the
+  // batch POST itself went through the client's interceptors
+  onItem?: (url: string, status: number, batch: AxiosResponse) => void;
+}
+
+export const createRequestBatcher = (
+  client: Pick<AxiosInstance, 'get' | 'post'>,
+  options: BatcherOptions = {},
+) => {
+  let queue = new Map<string, Pending>();
+  let flushScheduled = false;
+  // Turned off for the session once the server says it has no batch endpoint
+  let batchSupported = true;
+
+  const fetchSingle = (pending: Pending) => {
+    client.get(pending.url).then(
+      (res) => pending.waiters.forEach((w) => w.resolve(res)),
+      (error) => pending.waiters.forEach((w) => w.reject(error)),
+    );
+  };
+
+  // Failed items are re-issued as plain GETs so they get the client's full handling:
+  // session-expiry logout on 401/403, the route's retry policy and its metrics
+  const settle = (pending: Pending, status: number, body: any, batch: AxiosResponse) => {
+    if (status >= 200 && status < 400) {
+      options.onItem?.(pending.url, status, batch);
+      const res = { data: body, status };
+      pending.waiters.forEach((w) => w.resolve(res));
+    } else {
+      fetchSingle(pending);
+    }
+  };
+
+  const flush = async () => {
+    flushScheduled = false;
+    const batch = Array.from(queue.values());
+    queue = new Map();
+
+    if (batch.length === 1 || !batchSupported) {
+      batch.forEach(fetchSingle);
+      return;
+    }
+
+    try {
+      const res = await client.post(BATCH_ENDPOINT, {
+        requests: batch.map((p) => ({ id: p.id, method: 'GET', url: p.url })),
+      });
+      const byId = new Map<string, any>();
+      for (const item of res.data?.responses ?? []) {
+        byId.set(String(item.id), item);
+      }
+      for (const pending of batch) {
+        const item = byId.get(pending.id);
+        if (item) {
+          settle(pending, Number(item.status), item.body, res);
+        } else {
+          fetchSingle(pending);
+        }
+      }
+    } catch (error: any) {
+      if (error?.response?.status === 404 || error?.response?.status === 405) {
+        batchSupported = false;
+      }
+      console.log('Batch request failed, falling back to individual calls:', error?.message);
+      batch.forEach(fetchSingle);
+    }
+  };
+
+  return {
+    get<T = any>(url: string): Promise<BatchedResponse<T>> {
+      return new Promise((resolve, reject) => {
+        // Identical GETs in the same tick share one sub-request
+        let pending = queue.get(url);
+        if (!pending) {
+          pending = { id: String(queue.size), url, waiters: [] };
+          queue.set(url, pending);
+        }
+        pending.waiters.push({ resolve, reject });
+        if (!flushScheduled) {
+          flushScheduled = true;
+          setTimeout(flush, 0);
+        }
+      });
+    },
+  };
+};
@@ -0,0 +1,94 @@
+import AsyncStorage from '@react-native-async-storage/async-storage';
+import { getToken, getUser } from './TokenManager';
+
+// Offline-first response cache: screens render the last known response right away
+// and revalidate in the background. One storage key per entry (no shared JSON blob),
+// namespaced per user. Entries are plain JSON in AsyncStorage like the token itself,
+// so they are deleted on logout rather than relied on to be unreadable.
+const PREFIX = 'rc:';
+
+type Entry = { data: any; at: number };
+
+let namespace = '';
+let entries = new Map<string, Entry>();
+let hydrating: Promise<void> | null = null;
+
+const storageKey = (url: string) => `${PREFIX}${namespace}:${url}`;
+
+const parse = (payload: string): Entry | null => {
+  try {
+    const entry = JSON.parse(payload);
+    return entry && typeof entry.at === 'number' ? entry : null;
+  } catch {
+    return null;
+  }
+};
+
+const load = async () => {
+  const [token, user] = await Promise.all([getToken(), getUser()]);
+  entries = new Map();
+  if (!token) {
+    namespace = '';
+    return;
+  }
+  const userId = String(user?.id ?? user?.email ?? 'anonymous');
+  namespace = userId.replace(/:/g, '_');
+
+  const keys = (await AsyncStorage.getAllKeys()).filter((k) => k.startsWith(`${PREFIX}${namespace}:`));
+  const stale: string[] = [];
+  for (const [key, payload] of await AsyncStorage.multiGet(keys)) {
+    const entry = payload ? parse(payload) : null;
+    if (entry) {
+      entries.set(key.slice(PREFIX.length + namespace.length + 1), entry);
+    } else {
+      stale.push(key); // Unreadable (older format)
+    }
+  }
+  if (stale.length) {
+    AsyncStorage.multiRemove(stale).catch(() => {});
+  }
+};
+
+export const ResponseCache = {
+  // Loads the current user's entries into memory; call again after login/logout
+  hydrate(force = false) {
+    if (!hydrating || force) {
+      hydrating = load().catch((error) => {
+        console.log('Response cache hydrate error:', error);
+      });
+    }
+    return hydrating;
+  },
+
+  // Synchronous read of the last known response body
+  peek<T = any>(url: string): T | undefined {
+    return entries.get(url)?.data;
+  },
+
+  put(url: string, data: any) {
+    if (!namespace) return;
+    const entry = { data, at: Date.now() };
+    entries.set(url, entry);
+    AsyncStorage.setItem(storageKey(url), JSON.stringify(entry)).catch((error) => {
+      console.log('Response cache write error:', error);
+    });
+  },
+
+  // Drops the in-memory view when the session changes; the next hydrate reloads it
+  reset() {
+    entries = new Map();
+    namespace = '';
+    hydrating = null;
+  },
+
+  // Deletes every user's entries from disk; called on logout
+  async clear() {
+    entries = new Map();
+    namespace = '';
+    hydrating = null;
+    const keys = (await AsyncStorage.getAllKeys()).filter((k) => k.startsWith(PREFIX));
+    await AsyncStorage.multiRemove(keys);
+  },
+};
+
+export default ResponseCache;
@@ -0,0 +1,155 @@
+import 'react-native-get-random-values';
+
+// Per-endpoint retry policy used by the response interceptor in Api.tsx
+export interface RetryPolicy {
+  // Total retries after the first attempt
+  maxRetries: number;
+  // Send an Idempotency-Key header so the server can dedupe replays
+  idempotent: boolean;
+  // HTTP statuses worth retrying (network errors and timeouts are always retryable)
+  retryStatuses: number[];
+}
+
+const GET_POLICY: RetryPolicy = {
+  maxRetries: 2,
+  idempotent: false,
+  retryStatuses: [500, 502, 503, 504],
+};
+
+// Mutations are not retried unless the endpoint is covered by an idempotency key
+const MUTATION_POLICY: RetryPolicy = {
+  maxRetries: 0,
+  idempotent: false,
+  retryStatuses: [],
+};
+
+// Orders: replay only with the same key, and only when the server did not process it
+const ORDER_POLICY: RetryPolicy = {
+  maxRetries: 2,
+  idempotent: true,
+  retryStatuses: [502, 503, 504],
+};
+
+const ENDPOINT_POLICIES: { method: string; pattern: RegExp; policy: RetryPolicy }[] = [
+  { method: 'post', pattern: /^\/?client\/create-transactions\//, policy: ORDER_POLICY },
+  // Read-only lookups that happen to be POSTs
+  { method: 'post', pattern: /^\/?client\/transaction-(pending|success|failed)\//, policy: GET_POLICY },
+];
+
+export const getRetryPolicy = (method?: string, url?: string): RetryPolicy => {
+  const m = (method || 'get').toLowerCase();
+  const path = url || '';
+  for (const entry of ENDPOINT_POLICIES) {
+    if (entry.method === m && entry.pattern.test(path)) {
+      return entry.policy;
+    }
+  }
+  return m === 'get' || m === 'head' ? GET_POLICY : MUTATION_POLICY;
+};
+
+const isTimeout = (error: any) =>
+  error?.code === 'ECONNABORTED' || /timeout/i.test(error?.message || '');
+
+export const isRetryableError = (error: any, policy: RetryPolicy, retryCount: number) => {
+  if (retryCount >= policy.maxRetries) return false;
+  // 401/403/422 never get better by retrying
+  if (!error?.response) return true; // Network error
+  if (isTimeout(error)) return true;
+  return policy.retryStatuses.includes(error.response.status);
+};
+
+// Exponential backoff with full jitter: random in [0, min(cap, base * 2^attempt))
+const BACKOFF_BASE = 500;
+const BACKOFF_CAP = 10000;
+
+export const computeBackoff = (
+  attempt: number,
+  random: () => number = Math.random,
+  base = BACKOFF_BASE,
+  cap = BACKOFF_CAP,
+) => {
+  const ceiling = Math.min(cap, base * 2 ** attempt);
+  return Math.floor(random() * ceiling);
+};
+
+// RFC 4122 v4 UUID from the polyfilled crypto.getRandomValues
+export const generateIdempotencyKey = () => {
+  const bytes = new Uint8Array(16);
+  (global as any).crypto.getRandomValues(bytes);
+  bytes[6] = (bytes[6] & 0x0f) | 0x40;
+  bytes[8] = (bytes[8] & 0x3f) | 0x80;
+  let hex = '';
+  for (let i = 0; i < 16; i++) {
+    hex += bytes[i].toString(16).padStart(2, '0');
+  }
+  return `${hex.slice(0, 8)}-${hex.slice(8, 12)}-${hex.slice(12, 16)}-${hex.slice(16, 20)}-${hex.slice(20)}`;
+};
+
+type BreakerState = {
+  failures: number;
+  openedAt: number;
+  probing: boolean;
+};
+
+// Per-host circuit breaker: opens after consecutive failures, lets one probe through after cooldown
+export class CircuitBreaker {
+  private hosts = new Map<string, BreakerState>();
+
+  constructor(
+    private threshold = 5,
+    private cooldownMs = 30000,
+    private now: () => number = Date.now,
+  ) {}
+
+  private get(host: string) {
+    let state = this.hosts.get(host);
+    if (!state) {
+      state = { failures: 0, openedAt: 0, probing: false };
+      this.hosts.set(host, state);
+    }
+    return state;
+  }
+
+  canRequest(host: string) {
+    const state = this.get(host);
+    if (state.failures < this.threshold) return true;
+    if (this.now() - state.openedAt < this.cooldownMs || state.probing) return false;
+    state.probing = true; // Half-open
+    return true;
+  }
+
+  recordSuccess(host: string) {
+    const state = this.get(host);
+    state.failures = 0;
+    state.probing = false;
+  }
+
+  // The half-open probe ended without an answer (cancelled): let the next request probe
+  releaseProbe(host: string) {
+    this.get(host).probing = false;
+  }
+
+  recordFailure(host: string) {
+    const state = this.get(host);
+    state.failures += 1;
+    state.probing = false;
+    if (state.failures >= this.threshold) {
+      state.openedAt = this.now();
+    }
+  }
+
+  isOpen(host: string) {
+    const state = this.get(host);
+    return state.failures >= this.threshold;
+  }
+}
+
+export const getHost = (baseURL?: string, url?: string) => {
+  const full = /^https?:\/\//.test(url || '') ? url : baseURL;
+  const match = /^https?:\/\/([^/]+)/.exec(full || '');
+  return match ? match[1] : '';
+};
+
+// Failures that say something about the host, not the request
+export const isHostFailure = (error: any) =>
+  !error?.response || isTimeout(error) || error.response.status >= 500;
@@ -0,0 +1,134 @@
+// In-memory inverted index with prefix lookup.
+//
+// Terms map to posting lists of document ids. The sorted term list is built once,
+// on the first query (so the initial bulk load is one sort), and from then on new
+// and vanished terms are binary-inserted/removed as they are indexed, so a socket
+// or sync merge never costs the next keystroke a full re-sort. A query is a binary
+// search plus a walk over the matching terms.
+
+// Lowercase, strip Vietnamese diacritics (đ included) so "Việt" matches "viet"
+export const foldText = (text: string) =>
+  text
+    .normalize('NFD')
+    .replace(/[\u0300-\u036f]/g, '')
+    .replace(/đ/g, 'd')
+    .replace(/Đ/g, 'd')
+    .toLowerCase();
+
+// Query words, folded. "2.640.000" / "2,640,000" become "2640000" so grouped
+// amounts match the plain digits that are indexed; "12,5" becomes "12.5".
+export const queryTokens = (query: string) =>
+  foldText(query)
+    .split(/[\s/]+/)
+    .map((token) =>
+      /^\d{1,3}([.,]\d{3})+$/.test(token) ? token.replace(/[.,]/g, '') : token.replace(/,/g, '.'),
+    )
+    .filter(Boolean);
+
+export interface SearchIndex {
+  // `previous` are the terms the id was last set with; the caller keeps them (it has
+  // the old record), so the index holds no per-document term lists
+  set(id: number, terms: string[], previous?: string[]): void;
+  remove(id: number, terms: string[]): void;
+  // Ids whose terms match every token by prefix
+  search(tokens: string[]): Set<number>;
+  size(): { documents: number; terms: number; postings: number };
+}
+
+export const createSearchIndex = (): SearchIndex => {
+  // Most terms (hashes, order codes, accounts) belong to one document: those hold the
+  // bare id instead of a one-element array, which roughly halves the index size
+  const postings = new Map<string, number | number[]>();
+  const documents = new Set<number>();
+  let sorted: string[] = [];
+  // Until the first query there is no sorted list to maintain
+  let built = false;
+
+  const unlink = (id: number, terms: string[]) => {
+    if (!documents.delete(id)) return;
+    for (const term of new Set(terms)) {
+      const list = postings.get(term);
+      if (typeof list === 'number') {
+        if (list === id) {
+          postings.delete(term);
+          if (built) {
+            const at = lowerBound(term);
+            if (sorted[at] === term) sorted.splice(at, 1);
+          }
+        }
+        continue;
+      }
+      const at = list ? list.indexOf(id) : -1;
+      if (at < 0) continue;
+      list!.splice(at, 1);
+      if (list!.length === 1) postings.set(term, list![0]);
+    }
+  };
+
+  // First index in `sorted` with term >= prefix
+  const lowerBound = (prefix: string) => {
+    let lo = 0;
+    let hi = sorted.length;
+    while (lo < hi) {
+      const mid = (lo + hi) >>> 1;
+      if (sorted[mid] < prefix) lo = mid + 1;
+      else hi = mid;
+    }
+    return lo;
+  };
+
+  // Ids under every term starting with `prefix`; with `within`, only ids already in it
+  const matchPrefix = (prefix: string, within: Set<number> | null) => {
+    const ids = new Set<number>();
+    const add = (id: number) => {
+      if (!within || within.has(id)) ids.add(id);
+    };
+    for (let i = lowerBound(prefix); i < sorted.length && sorted[i].startsWith(prefix); i++) {
+      const list = postings.get(sorted[i]);
+      if (typeof list === 'number') add(list);
+      else if (list) list.forEach(add);
+    }
+    return ids;
+  };
+
+  return {
+    set(id, terms, previous) {
+      if (previous) unlink(id, previous);
+      documents.add(id);
+      for (const term of new Set(terms)) {
+        if (!term) continue;
+        const list = postings.get(term);
+        if (list === undefined) {
+          postings.set(term, id);
+          if (built) sorted.splice(lowerBound(term), 0, term);
+        } else if (typeof list === 'number') {
+          postings.set(term, [list, id]);
+        } else {
+          list.push(id);
+        }
+      }
+    },
+
+    remove: unlink,
+
+    search(tokens) {
+      if (!built) {
+        sorted = Array.from(postings.keys()).sort();
+        built = true;
+      }
+      let result: Set<number> | null = null;
+      // Longest first: it matches the fewest terms, and later (broad) tokens only narrow it
+      for (const token of [...tokens].sort((a, b) => b.length - a.length)) {
+        result = matchPrefix(token, result);
+        if (result.size === 0) break;
+      }
+      return result ?? new Set();
+    },
+
+    size() {
+      let count = 0;
+      postings.forEach((list) => (count += typeof list === 'number' ? 1 : list.length));
+      return { documents: documents.size, terms: postings.size, postings: count };
+    },
+  };
+};
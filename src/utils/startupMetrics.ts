@@ -0,0 +1,19 @@
+// Cold-start time-to-content marks. Imported first from index.js so the
+// reference point is as close to bundle start as JS can observe.
+const appStart = Date.now();
+
+export type ContentSource = 'cache' | 'network';
+
+const marks: { name: string; source: ContentSource; ms: number }[] = [];
+const seen = new Set<string>();
+
+// Records the first time a screen shows real data in this process
+export const markTimeToContent = (name: string, source: ContentSource) => {
+  if (seen.has(name)) return;
+  seen.add(name);
+  const ms = Date.now() - appStart;
+  marks.push({ name, source, ms });
+  console.log(`[Startup] ${name} content from ${source} after ${ms}ms`);
+};
+
+export const getStartupMarks = () => marks.slice();
@@ -0,0 +1,87 @@
+// Time index over transactions: ids sorted by created_at with a parallel array of
+// timestamps, so a date filter is two binary searches and a slice instead of a
+// parse-and-compare pass over the whole history.
+
+export type TimeIndex = {
+  // Ascending created_at, ms
+  at: number[];
+  ids: number[];
+};
+
+// Half-open [from, to) in ms
+export type TimeRange = { from: number; to: number };
+
+const DAY = 24 * 60 * 60 * 1000;
+
+// Accepts the API's "2025-09-13T10:05:00.000000Z" and "2025-09-13 10:05:00"; NaN otherwise.
+// Trimmed to millisecond precision since not every engine parses microseconds.
+export const parseTimestamp = (value?: string | null) => {
+  if (!value) return NaN;
+  return Date.parse(value.replace(' ', 'T').replace(/(\.\d{3})\d+/, '$1'));
+};
+
+export const buildTimeIndex = (ids: number[], timeOf: (id: number) => number): TimeIndex => {
+  // History arrives newest first, so walking it backwards is usually already sorted
+  const at: number[] = [];
+  const sortedIds: number[] = [];
+  let sorted = true;
+  for (let i = ids.length - 1; i >= 0; i--) {
+    const time = timeOf(ids[i]);
+    if (isNaN(time)) continue;
+    if (at.length && time < at[at.length - 1]) sorted = false;
+    at.push(time);
+    sortedIds.push(ids[i]);
+  }
+  if (sorted) return { at, ids: sortedIds };
+
+  const order = sortedIds.map((_, i) => i).sort((a, b) => at[a] - at[b]);
+  return { at: order.map((i) => at[i]), ids: order.map((i) => sortedIds[i]) };
+};
+
+// First index with at[index] >= time
+const lowerBound = (at: number[], time: number) => {
+  let lo = 0;
+  let hi = at.length;
+  while (lo < hi) {
+    const mid = (lo + hi) >>> 1;
+    if (at[mid] < time) lo = mid + 1;
+    else hi = mid;
+  }
+  return lo;
+};
+
+// Ids created within the range, oldest first
+export const idsInRange = (index: TimeIndex, { from, to }: TimeRange) =>
+  index.ids.slice(lowerBound(index.at, from), lowerBound(index.at, to));
+
+// '1d' | '1w' | '1m' | '6m', counted back from now
+export const presetRange = (id: string, now = Date.now()): TimeRange => {
+  const from = new Date(now);
+  if (id === '1d') from.setTime(now - DAY);
+  else if (id === '1w') from.setTime(now - 7 * DAY);
+  else if (id === '1m') from.setMonth(from.getMonth() - 1);
+  else if (id === '6m') from.setMonth(from.getMonth() - 6);
+  return { from: from.getTime(), to: Infinity };
+};
+
+// Calendar month, local time; month is 1-12
+export const monthRange = (month: number, year: number): TimeRange => ({
+  from: new Date(year, month - 1, 1).getTime(),
+  to: new Date(year, month, 1).getTime(),
+});
+
+const pad = (n: number) => String(n).padStart(2, '0');
+
+// Local 'YYYY-MM-DD', the format dayRange takes
+export const toDayString = (date: Date) =>
+  `${date.getFullYear()}-${pad(date.getMonth() + 1)}-${pad(date.getDate())}`;
+
+// Whole days from start to end inclusive, 'YYYY-MM-DD' in local time
+export const dayRange = (start: string, end: string): TimeRange => {
+  const [sy, sm, sd] = start.split('-').map(Number);
+  const [ey, em, ed] = end.split('-').map(Number);
+  return {
+    from: new Date(sy, sm - 1, sd).getTime(),
+    to: new Date(ey, em - 1, ed + 1).getTime(),
+  };
+};
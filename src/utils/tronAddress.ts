@@ -0,0 +1,157 @@
+// TRON (TRC20) address validation, run on every keystroke of the address field.
+//
+// Base58Check form: 34 characters decoding to 25 bytes, 0x41 + 20-byte account +
+// the first 4 bytes of sha256(sha256(first 21 bytes)). Hex form: "41" + 40 hex
+// digits, optionally 0x-prefixed, which carries no checksum.
+//
+// Everything works in preallocated typed arrays: both SHA-256 inputs fit one
+// block, so a check allocates nothing.
+
+export type AddressCheck =
+  | 'empty'
+  // A valid prefix of an address: keep typing
+  | 'incomplete'
+  // A character no TRON address contains at that position
+  | 'invalid-char'
+  // Complete but wrong: bad length, prefix or checksum
+  | 'invalid'
+  | 'valid';
+
+const BASE58_ALPHABET = '123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz';
+const BASE58_LENGTH = 34;
+const HEX_LENGTH = 42;
+
+// char code -> base58 digit, -1 outside the alphabet
+const BASE58_DIGITS = new Int8Array(128).fill(-1);
+for (let i = 0; i < BASE58_ALPHABET.length; i++) BASE58_DIGITS[BASE58_ALPHABET.charCodeAt(i)] = i;
+
+const K = new Int32Array([
+  0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+  0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+  0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+  0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+  0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+  0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+  0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+  0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+]);
+const IV = new Int32Array([
+  0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+]);
+
+// Scratch: decoded bytes, message schedule, hash state. Words are kept as int32
+// (same bits) so the arithmetic stays in small integers
+const bytes = new Uint8Array(25);
+const limbs = new Int32Array(9);
+const W = new Int32Array(64);
+const H = new Int32Array(8);
+
+const rotr = (x: number, n: number) => (x >>> n) | (x << (32 - n));
+
+// SHA-256 of the single padded block already in W[0..15]; result in H
+const compress = () => {
+  for (let i = 16; i < 64; i++) {
+    const w15 = W[i - 15];
+    const w2 = W[i - 2];
+    const s0 = rotr(w15, 7) ^ rotr(w15, 18) ^ (w15 >>> 3);
+    const s1 = rotr(w2, 17) ^ rotr(w2, 19) ^ (w2 >>> 10);
+    W[i] = (W[i - 16] + s0 + W[i - 7] + s1) | 0;
+  }
+  let a = IV[0], b = IV[1], c = IV[2], d = IV[3], e = IV[4], f = IV[5], g = IV[6], h = IV[7];
+  for (let i = 0; i < 64; i++) {
+    const t1 = (h + (rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25)) + ((e & f) ^ (~e & g)) + K[i] + W[i]) | 0;
+    const t2 = ((rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22)) + ((a & b) ^ (a & c) ^ (b & c))) | 0;
+    h = g;
+    g = f;
+    f = e;
+    e = (d + t1) | 0;
+    d = c;
+    c = b;
+    b = a;
+    a = (t1 + t2) | 0;
+  }
+  H[0] = (IV[0] + a) | 0; H[1] = (IV[1] + b) | 0; H[2] = (IV[2] + c) | 0; H[3] = (IV[3] + d) | 0;
+  H[4] = (IV[4] + e) | 0; H[5] = (IV[5] + f) | 0; H[6] = (IV[6] + g) | 0; H[7] = (IV[7] + h) | 0;
+};
+
+// First 4 bytes of sha256(sha256(bytes[0..21))) as a big-endian int32
+const checksum21 = () => {
+  W.fill(0, 0, 16);
+  for (let i = 0; i < 21; i++) W[i >> 2] |= bytes[i] << (24 - 8 * (i & 3));
+  W[5] |= 0x80 << 16; // padding bit after byte 21
+  W[15] = 21 * 8;
+  compress();
+  // Second pass: the 32-byte digest is already eight big-endian words
+  for (let i = 0; i < 8; i++) W[i] = H[i];
+  W.fill(0, 8, 16);
+  W[8] = 0x80000000 | 0;
+  W[15] = 32 * 8;
+  compress();
+  return H[0];
+};
+
+// Base58 digits -> 25 bytes in `bytes`; false when the value does not fit. The
+// number is built in nine 24-bit limbs (216 bits) so a digit costs 9 steps, not 25
+const decodeBase58 = (text: string) => {
+  limbs.fill(0);
+  for (let i = 0; i < text.length; i++) {
+    let carry = BASE58_DIGITS[text.charCodeAt(i)];
+    for (let j = 8; j >= 0; j--) {
+      carry += limbs[j] * 58;
+      limbs[j] = carry & 0xffffff;
+      carry >>>= 24;
+    }
+    if (carry) return false;
+  }
+  // 216 bits -> 27 bytes; the top two must be zero for a 25-byte value
+  if (limbs[0] >>> 8) return false;
+  bytes[0] = limbs[0] & 0xff;
+  for (let j = 1; j < 9; j++) {
+    const limb = limbs[j];
+    bytes[3 * j - 2] = limb >>> 16;
+    bytes[3 * j - 1] = (limb >>> 8) & 0xff;
+    bytes[3 * j] = limb & 0xff;
+  }
+  return true;
+};
+
+const isHexDigit = (code: number) =>
+  (code >= 48 && code <= 57) || (code >= 65 && code <= 70) || (code >= 97 && code <= 102);
+
+const checkHex = (text: string, from: number): AddressCheck => {
+  const length = text.length - from;
+  for (let i = from; i < text.length; i++) {
+    if (!isHexDigit(text.charCodeAt(i))) return 'invalid-char';
+  }
+  // "41" prefix, as far as it is typed
+  if (length >= 1 && text.charCodeAt(from) !== 52) return 'invalid';
+  if (length >= 2 && text.charCodeAt(from + 1) !== 49) return 'invalid';
+  if (length < HEX_LENGTH) return 'incomplete';
+  return length === HEX_LENGTH ? 'valid' : 'invalid';
+};
+
+// State of a (possibly partly typed) address; surrounding spaces are ignored
+export const checkTronAddress = (input: string): AddressCheck => {
+  const text = input.trim();
+  if (!text) return 'empty';
+
+  const first = text.charCodeAt(0);
+  if (first === 48 /* 0 */) {
+    if (text.length === 1) return 'incomplete';
+    if (text.charCodeAt(1) === 120 /* x */) return checkHex(text, 2);
+  }
+  if (first === 52 /* 4 */) return checkHex(text, 0);
+  if (first !== 84 /* T */) return 'invalid-char';
+
+  for (let i = 1; i < text.length; i++) {
+    const code = text.charCodeAt(i);
+    if (code >= 128 || BASE58_DIGITS[code] < 0) return 'invalid-char';
+  }
+  if (text.length < BASE58_LENGTH) return 'incomplete';
+  if (text.length > BASE58_LENGTH || !decodeBase58(text) || bytes[0] !== 0x41) return 'invalid';
+
+  const expected = (bytes[21] << 24) | (bytes[22] << 16) | (bytes[23] << 8) | bytes[24];
+  return checksum21() === expected ? 'valid' : 'invalid';
+};
+
+export const isTronAddress = (input: string) => checkTronAddress(input) === 'valid';